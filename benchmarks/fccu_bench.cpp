@@ -0,0 +1,377 @@
+/**
+ * @file fccu_bench.cpp
+ * @brief fccu-cpp hot-path benchmarks with machine-readable JSON output.
+ *
+ * Scenarios:
+ *   report.*     ReportFault / ReportFaults ns/op, single thread and cross-core
+ *   process.*    ProcessFaults drain throughput
+ *   latency.*    End-to-end report-to-hook latency percentiles (cross-core)
+ *   admission.*  FaultQueueSet admission under a sustained storm
+ *   hsm.*        GlobalHsm / PerFaultHsm dispatch cost
+ *
+ * Usage: fccu_bench [--out FILE] [--quick]
+ *   --out FILE  JSON output path (default: fccu_bench.json)
+ *   --quick     Fewer repetitions (CI smoke run)
+ *
+ * Each result is one flat {"name", "value", "unit"} record so two runs can be
+ * diffed line by line. Repeated measurements report the median.
+ */
+
+#include "fccu/fccu.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// ============================================================================
+// Harness
+// ============================================================================
+
+uint64_t NowNs() noexcept {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+double Median(std::vector<double> v) {
+  if (v.empty()) {
+    return 0.0;
+  }
+  std::sort(v.begin(), v.end());
+  return v[v.size() / 2U];
+}
+
+struct BenchResult {
+  std::string name;
+  double value;
+  const char* unit;
+};
+
+class BenchReport {
+ public:
+  void Add(const std::string& name, double value, const char* unit) {
+    results_.push_back(BenchResult{name, value, unit});
+    std::printf("  %-44s %14.2f %s\n", name.c_str(), value, unit);
+  }
+
+  bool WriteJson(const char* path) const {
+    FILE* f = std::fopen(path, "w");
+    if (f == nullptr) {
+      return false;
+    }
+    std::fprintf(f, "{\n  \"schema\": 1,\n  \"compiler\": \"%s\",\n  \"threads\": %u,\n  \"results\": [\n", Compiler(),
+                 std::thread::hardware_concurrency());
+    for (size_t i = 0U; i < results_.size(); ++i) {
+      const BenchResult& r = results_[i];
+      std::fprintf(f, "    {\"name\": \"%s\", \"value\": %.3f, \"unit\": \"%s\"}%s\n", r.name.c_str(), r.value, r.unit,
+                   (i + 1U < results_.size()) ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+    return std::fclose(f) == 0;
+  }
+
+ private:
+  static const char* Compiler() noexcept {
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#else
+    return "unknown";
+#endif
+  }
+
+  std::vector<BenchResult> results_;
+};
+
+struct BenchConfig {
+  uint32_t repeats = 31U;
+  uint32_t cross_core_ops = 1000000U;
+  uint32_t latency_samples = 200000U;
+  uint32_t storm_ops = 1000000U;
+  uint32_t hsm_cycles = 200000U;
+};
+
+fccu::HookAction HandledHook(const fccu::FaultEvent& /*e*/, void* /*ctx*/) { return fccu::HookAction::kHandled; }
+
+constexpr uint32_t kFaults = 64U;
+constexpr uint32_t kDepth = 1024U;
+
+using BenchCollector = fccu::FaultCollector<kFaults, kDepth, 4U, 8U>;
+
+struct LatencyPolicy : fccu::DefaultCollectorPolicy {
+  static constexpr bool kLatencyHistograms = true;
+};
+using LatencyCollector = fccu::FaultCollector<kFaults, kDepth, 4U, 8U, 1U, LatencyPolicy>;
+
+struct PackedPolicy : fccu::DefaultCollectorPolicy {
+  using Entry = fccu::PackedFaultEntry;
+};
+using PackedCollector = fccu::FaultCollector<kFaults, kDepth, 4U, 8U, 1U, PackedPolicy>;
+
+template <typename Collector>
+void Setup(Collector& c) {
+  for (uint16_t i = 0U; i < kFaults; ++i) {
+    c.RegisterFault(i, 0x1000U + i);
+  }
+  c.SetDefaultHook(HandledHook);
+}
+
+// ============================================================================
+// report.*
+// ============================================================================
+
+void BenchReportSingle(const BenchConfig& cfg, BenchReport& out) {
+  auto c = std::make_unique<BenchCollector>();
+  Setup(*c);
+
+  std::vector<double> samples;
+  for (uint32_t r = 0U; r < cfg.repeats; ++r) {
+    uint64_t t0 = NowNs();
+    for (uint32_t i = 0U; i < kDepth; ++i) {
+      c->ReportFault(static_cast<fccu::FaultIndex>(i % kFaults), i, fccu::FaultPriority::kCritical);
+    }
+    uint64_t t1 = NowNs();
+    c->ProcessFaults();
+    samples.push_back(static_cast<double>(t1 - t0) / kDepth);
+  }
+  out.Add("report.single_thread", Median(samples), "ns/op");
+
+  constexpr uint32_t kBatch = 32U;
+  std::array<fccu::FaultReport, kBatch> batch{};
+  for (uint32_t i = 0U; i < kBatch; ++i) {
+    batch[i] = fccu::FaultReport{static_cast<fccu::FaultIndex>(i % kFaults), i, fccu::FaultPriority::kCritical};
+  }
+  samples.clear();
+  for (uint32_t r = 0U; r < cfg.repeats; ++r) {
+    uint64_t t0 = NowNs();
+    for (uint32_t n = 0U; n < kDepth; n += kBatch) {
+      c->ReportFaults(batch.data(), kBatch);
+    }
+    uint64_t t1 = NowNs();
+    c->ProcessFaults();
+    samples.push_back(static_cast<double>(t1 - t0) / kDepth);
+  }
+  out.Add("report.batch32_single_thread", Median(samples), "ns/op");
+}
+
+void BenchReportCrossCore(const BenchConfig& cfg, BenchReport& out) {
+  auto c = std::make_unique<BenchCollector>();
+  Setup(*c);
+  c->SetHsmDispatchMode(fccu::HsmDispatchMode::kOnProcess);
+
+  std::atomic<bool> stop{false};
+  std::thread consumer([&] {
+    while (!stop.load(std::memory_order_acquire)) {
+      c->ProcessFaults(64U);
+    }
+    c->ProcessFaults();
+  });
+
+  uint32_t dropped = 0U;
+  uint64_t t0 = NowNs();
+  for (uint32_t i = 0U; i < cfg.cross_core_ops; ++i) {
+    if (c->ReportFault(static_cast<fccu::FaultIndex>(i % kFaults), i, fccu::FaultPriority::kCritical) !=
+        fccu::FccuError::kOk) {
+      ++dropped;
+    }
+  }
+  uint64_t t1 = NowNs();
+  stop.store(true, std::memory_order_release);
+  consumer.join();
+
+  out.Add("report.cross_core", static_cast<double>(t1 - t0) / cfg.cross_core_ops, "ns/op");
+  out.Add("report.cross_core_drop_rate", 100.0 * dropped / cfg.cross_core_ops, "%");
+}
+
+// ============================================================================
+// process.*
+// ============================================================================
+
+template <typename Collector>
+void BenchProcessDrain(const BenchConfig& cfg, BenchReport& out, const char* name) {
+  auto c = std::make_unique<Collector>();
+  Setup(*c);
+
+  std::vector<double> samples;
+  for (uint32_t r = 0U; r < cfg.repeats; ++r) {
+    for (uint32_t i = 0U; i < kDepth; ++i) {
+      c->ReportFault(static_cast<fccu::FaultIndex>(i % kFaults), i, fccu::FaultPriority::kCritical);
+    }
+    uint64_t t0 = NowNs();
+    uint32_t n = c->ProcessFaults();
+    uint64_t t1 = NowNs();
+    if (n > 0U && t1 > t0) {
+      samples.push_back(static_cast<double>(n) * 1e3 / static_cast<double>(t1 - t0));
+    }
+  }
+  out.Add(name, Median(samples), "Mentries/s");
+}
+
+// ============================================================================
+// latency.*
+// ============================================================================
+
+void BenchEndToEndLatency(const BenchConfig& cfg, BenchReport& out) {
+  auto c = std::make_unique<LatencyCollector>();
+  Setup(*c);
+  c->SetHsmDispatchMode(fccu::HsmDispatchMode::kOnProcess);
+
+  std::atomic<bool> stop{false};
+  std::thread consumer([&] {
+    while (!stop.load(std::memory_order_acquire)) {
+      c->ProcessFaults();
+    }
+    c->ProcessFaults();
+  });
+
+  // Paced producer: one report per ~1 us so queueing delay, not saturation, is measured
+  for (uint32_t i = 0U; i < cfg.latency_samples; ++i) {
+    c->ReportFault(static_cast<fccu::FaultIndex>(i % kFaults), i, fccu::FaultPriority::kCritical);
+    uint64_t until = NowNs() + 1000U;
+    while (NowNs() < until) {
+    }
+  }
+  stop.store(true, std::memory_order_release);
+  consumer.join();
+
+  const auto& q = c->GetQueueLatency(0U);
+  out.Add("latency.report_to_hook_p50", static_cast<double>(q.P50()), "ns");
+  out.Add("latency.report_to_hook_p99", static_cast<double>(q.P99()), "ns");
+  out.Add("latency.report_to_hook_p999", static_cast<double>(q.P999()), "ns");
+  out.Add("latency.report_to_hook_max", static_cast<double>(q.Max()), "ns");
+  out.Add("latency.hook_exec_p99", static_cast<double>(c->GetHookLatency().P99()), "ns");
+}
+
+// ============================================================================
+// admission.*
+// ============================================================================
+
+void BenchAdmissionStorm(const BenchConfig& cfg, BenchReport& out) {
+  // Producer at 2x the consumer rate, equal mix of all four priorities
+  auto qs = std::make_unique<fccu::FaultQueueSet<fccu::FaultEntry, 4U, 256U>>();
+  std::array<uint64_t, 4U> admitted{};
+  std::array<uint64_t, 4U> attempted{};
+  fccu::FaultEntry entry{};
+  fccu::FaultEntry sink{};
+  uint8_t level = 0U;
+
+  uint64_t t0 = NowNs();
+  for (uint32_t i = 0U; i < cfg.storm_ops; ++i) {
+    uint8_t lvl = static_cast<uint8_t>(i & 3U);
+    entry.detail = i;
+    ++attempted[lvl];
+    if (qs->PushWithAdmission(lvl, entry)) {
+      ++admitted[lvl];
+    }
+    if ((i & 1U) != 0U) {
+      (void)qs->Pop(sink, level);
+    }
+  }
+  uint64_t t1 = NowNs();
+
+  static const char* const kNames[4] = {"critical", "high", "medium", "low"};
+  for (uint32_t l = 0U; l < 4U; ++l) {
+    out.Add(std::string("admission.storm_admit_rate_") + kNames[l], 100.0 * admitted[l] / attempted[l], "%");
+  }
+  out.Add("admission.storm_push_pop", static_cast<double>(t1 - t0) / cfg.storm_ops, "ns/op");
+}
+
+// ============================================================================
+// hsm.*
+// ============================================================================
+
+void BenchHsmDispatch(const BenchConfig& cfg, BenchReport& out) {
+  auto global = std::make_unique<fccu::GlobalHsm>();
+  uint64_t t0 = NowNs();
+  for (uint32_t i = 0U; i < cfg.hsm_cycles; ++i) {
+    global->Dispatch(fccu::evt::kFaultReported);
+    global->Dispatch(fccu::evt::kAllCleared);
+  }
+  uint64_t t1 = NowNs();
+  out.Add("hsm.global_dispatch", static_cast<double>(t1 - t0) / (2.0 * cfg.hsm_cycles), "ns/op");
+
+  auto per_fault = std::make_unique<fccu::PerFaultHsm>();
+  per_fault->Bind(0U, 1U);
+  t0 = NowNs();
+  for (uint32_t i = 0U; i < cfg.hsm_cycles; ++i) {
+    per_fault->Dispatch(fccu::evt::kDetected);
+    per_fault->Dispatch(fccu::evt::kConfirmed);
+    per_fault->Dispatch(fccu::evt::kClearFault);
+    per_fault->Dispatch(fccu::evt::kClearFault);
+  }
+  t1 = NowNs();
+  out.Add("hsm.per_fault_dispatch", static_cast<double>(t1 - t0) / (4.0 * cfg.hsm_cycles), "ns/op");
+
+  // Policy::kCompactHsm equivalents (volatile event ids keep the inlined lookups in the loop)
+  volatile uint32_t reported_evt = fccu::evt::kFaultReported;
+  volatile uint32_t cleared_evt = fccu::evt::kAllCleared;
+  auto compact_global = std::make_unique<fccu::CompactGlobalHsm>();
+  t0 = NowNs();
+  for (uint32_t i = 0U; i < cfg.hsm_cycles; ++i) {
+    compact_global->Dispatch(reported_evt);
+    compact_global->Dispatch(cleared_evt);
+  }
+  t1 = NowNs();
+  out.Add("hsm.compact_global_dispatch", static_cast<double>(t1 - t0) / (2.0 * cfg.hsm_cycles), "ns/op");
+
+  auto compact_faults = std::make_unique<fccu::CompactFaultHsmArray<kFaults>>();
+  t0 = NowNs();
+  for (uint32_t i = 0U; i < cfg.hsm_cycles; ++i) {
+    const uint32_t idx = i % kFaults;
+    compact_faults->Dispatch(idx, fccu::evt::kDetected);
+    compact_faults->Dispatch(idx, fccu::evt::kConfirmed, 1U, 1U);
+    compact_faults->Dispatch(idx, fccu::evt::kClearFault);
+    compact_faults->Dispatch(idx, fccu::evt::kClearFault);
+  }
+  t1 = NowNs();
+  out.Add("hsm.compact_per_fault_dispatch", static_cast<double>(t1 - t0) / (4.0 * cfg.hsm_cycles), "ns/op");
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* out_path = "fccu_bench.json";
+  BenchConfig cfg;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+      out_path = argv[++i];
+    } else if (std::strcmp(argv[i], "--quick") == 0) {
+      cfg.repeats = 5U;
+      cfg.cross_core_ops = 50000U;
+      cfg.latency_samples = 5000U;
+      cfg.storm_ops = 50000U;
+      cfg.hsm_cycles = 10000U;
+    } else {
+      std::fprintf(stderr, "usage: %s [--out FILE] [--quick]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  std::printf("=== fccu_bench ===\n");
+  BenchReport report;
+  BenchReportSingle(cfg, report);
+  BenchReportCrossCore(cfg, report);
+  BenchProcessDrain<BenchCollector>(cfg, report, "process.drain_throughput");
+  BenchProcessDrain<PackedCollector>(cfg, report, "process.drain_throughput_packed");
+  BenchEndToEndLatency(cfg, report);
+  BenchAdmissionStorm(cfg, report);
+  BenchHsmDispatch(cfg, report);
+
+  if (!report.WriteJson(out_path)) {
+    std::fprintf(stderr, "failed to write %s\n", out_path);
+    return 1;
+  }
+  std::printf("Results written to %s\n", out_path);
+  return 0;
+}
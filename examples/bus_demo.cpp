@@ -2,10 +2,12 @@
  * @file bus_demo.cpp
  * @brief FCCU + mccc AsyncBus integration demo.
  *
- * Demonstrates fault notification via mccc message bus.
+ * Demonstrates batched fault notification over the mccc message bus
+ * (FaultBusPublisher) and bulk fault ingest from the bus (FaultBusIngress).
  */
 
 #include "fccu/fccu.hpp"
+#include "fccu/fccu_mccc_bridge.hpp"
 #include "mccc/message_bus.hpp"
 
 #include <cstdint>
@@ -13,34 +15,13 @@
 
 #include <variant>
 
-// Message type for fault notifications over mccc bus
-struct FaultNotification {
-  uint16_t fault_index;
-  uint32_t fault_code;
-  uint32_t detail;
-  uint8_t priority;
-  uint64_t timestamp_us;
-};
-
-// mccc payload variant
-using BusPayload = std::variant<FaultNotification>;
+// mccc payload variant: processed-fault batches out, report batches in
+using RecordBatch = fccu::FaultRecordBatch<16>;
+using ReportBatch = fccu::FaultReportBatch<16>;
+using BusPayload = std::variant<RecordBatch, ReportBatch>;
 using Bus = mccc::AsyncBus<BusPayload>;
 
-// Bus notifier callback: publish fault events to mccc bus
-static Bus* g_bus = nullptr;
-
-static void BusNotifier(const fccu::FaultEvent& event, void* /*ctx*/) {
-  if (g_bus == nullptr) {
-    return;
-  }
-  FaultNotification msg{};
-  msg.fault_index = event.fault_index;
-  msg.fault_code = event.fault_code;
-  msg.detail = event.detail;
-  msg.priority = static_cast<uint8_t>(event.priority);
-  msg.timestamp_us = event.timestamp_us;
-  g_bus->Publish(BusPayload{msg}, 0U);
-}
+using Collector = fccu::FaultCollector<8, 16>;
 
 static fccu::HookAction SimpleHook(const fccu::FaultEvent& /*event*/, void* /*ctx*/) {
   return fccu::HookAction::kHandled;
@@ -49,36 +30,55 @@ static fccu::HookAction SimpleHook(const fccu::FaultEvent& /*event*/, void* /*ct
 int main() {
   std::printf("=== FCCU + mccc Bus Demo ===\n\n");
 
-  // Get mccc bus singleton
   Bus& bus = Bus::Instance();
-  g_bus = &bus;
 
-  // Subscribe to fault notifications (callback receives envelope)
-  bus.Subscribe<FaultNotification>([](const Bus::EnvelopeType& env) {
-    if (auto* msg = std::get_if<FaultNotification>(&env.payload)) {
-      std::printf("  [Bus] Received: fault_index=%u code=0x%04x detail=0x%x pri=%u\n", msg->fault_index,
-                  msg->fault_code, msg->detail, msg->priority);
+  // One bus message per ProcessFaults() batch
+  bus.Subscribe<RecordBatch>([](const Bus::EnvelopeType& env) {
+    if (auto* batch = std::get_if<RecordBatch>(&env.payload)) {
+      std::printf("  [Bus] Batch of %u fault(s):\n", batch->count);
+      for (uint32_t i = 0U; i < batch->count; ++i) {
+        const fccu::FaultRecord& rec = batch->records[i];
+        std::printf("        fault_index=%u code=0x%04x detail=0x%x pri=%u count=%u\n", rec.fault_index,
+                    rec.fault_code, rec.detail, rec.priority, rec.occurrence_count);
+      }
     }
   });
 
   // Create FCCU
-  fccu::FaultCollector<8, 16> collector;
+  Collector collector;
   collector.RegisterFault(0U, 0xA001U);
   collector.RegisterFault(1U, 0xA002U);
   collector.RegisterHook(0U, SimpleHook);
   collector.RegisterHook(1U, SimpleHook);
-  collector.SetBusNotifier(BusNotifier);
+
+  fccu::FaultBusPublisher<BusPayload> publisher(bus, 1U);
+  publisher.Attach(collector);
+  fccu::FaultBusIngress<Collector, BusPayload> ingress(collector, bus);
 
   std::printf("--- Reporting faults ---\n");
   collector.ReportFault(0U, 0x11, fccu::FaultPriority::kHigh);
   collector.ReportFault(1U, 0x22, fccu::FaultPriority::kMedium);
 
-  std::printf("\n--- Processing faults (triggers bus notifications) ---\n");
+  std::printf("\n--- Processing faults (one bus publish) ---\n");
   collector.ProcessFaults();
 
   std::printf("\n--- Processing bus messages ---\n");
   bus.ProcessBatch();
 
+  std::printf("\n--- Remote module reports a batch over the bus ---\n");
+  ReportBatch reports;
+  reports.Add(0U, 0x33, fccu::FaultPriority::kLow);
+  reports.Add(1U, 0x44, fccu::FaultPriority::kCritical);
+  bus.Publish(BusPayload{reports}, 2U);
+  bus.ProcessBatch();  // Ingress forwards into ReportFaults()
+  std::printf("  Ingested: admitted=%u dropped=%u\n", ingress.Totals().admitted, ingress.Totals().dropped);
+
+  collector.ProcessFaults();
+  bus.ProcessBatch();
+
+  std::printf("\n  Bus publishes: %u batch(es), %u record(s)\n", static_cast<unsigned>(publisher.PublishedBatches()),
+              static_cast<unsigned>(publisher.PublishedRecords()));
+
   std::printf("\n=== Demo Complete ===\n");
   return 0;
 }
@@ -0,0 +1,75 @@
+/**
+ * @file shm_demo.cpp
+ * @brief Cross-process fault reporting through a shared-memory FaultCollector.
+ *
+ * The parent is the FCCU daemon; two forked children attach as producer
+ * processes and report directly into the shared queues.
+ */
+
+#include "fccu/fccu.hpp"
+#include "fccu/fccu_shm.hpp"
+
+#include <cstdint>
+#include <cstdio>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using ShmCollector = fccu::FaultCollector<8, 16, 4, 2, 4, fccu::ShmCollectorPolicy>;
+
+static constexpr const char* kRegionName = "/fccu_shm_demo";
+
+static fccu::HookAction DaemonHook(const fccu::FaultEvent& event, void* /*ctx*/) {
+  std::printf("  [Daemon] fault_index=%u code=0x%04x detail=%u pri=%u\n", event.fault_index, event.fault_code,
+              event.detail, static_cast<unsigned>(event.priority));
+  return fccu::HookAction::kHandled;
+}
+
+static int RunClient(uint16_t fault_index) {
+  fccu::ShmFaultClient<ShmCollector> client;
+  if (client.Open(kRegionName) != fccu::FccuError::kOk) {
+    return 1;
+  }
+  fccu::FaultReporter reporter = client.GetReporter();
+  for (uint32_t i = 0U; i < 3U; ++i) {
+    reporter.Report(fault_index, static_cast<uint32_t>(getpid()) * 10U + i, fccu::FaultPriority::kHigh);
+  }
+  return 0;
+}
+
+int main() {
+  std::printf("=== FCCU Shared-Memory Demo ===\n\n");
+
+  fccu::ShmFaultCollectorHost<ShmCollector> host;
+  if (host.Create(kRegionName) != fccu::FccuError::kOk) {
+    std::printf("shm unavailable\n");
+    return 1;
+  }
+  ShmCollector& collector = *host.Get();
+  collector.RegisterFault(0U, 0xD001U);  // Driver process
+  collector.RegisterFault(1U, 0xD002U);  // Perception process
+  collector.SetDefaultHook(DaemonHook);
+  host.Publish();
+
+  std::printf("--- Two producer processes report ---\n");
+  pid_t children[2];
+  for (uint16_t i = 0U; i < 2U; ++i) {
+    children[i] = fork();
+    if (children[i] == 0) {
+      _exit(RunClient(i));
+    }
+  }
+  int failures = 0;
+  for (pid_t pid : children) {
+    int status = 0;
+    (void)waitpid(pid, &status, 0);
+    failures += (WIFEXITED(status) && WEXITSTATUS(status) == 0) ? 0 : 1;
+  }
+
+  std::printf("\n--- Daemon processes ---\n");
+  uint32_t processed = collector.ProcessFaults();
+  std::printf("\nProcessed %u faults from %d client(s)\n", processed, 2 - failures);
+
+  std::printf("\n=== Demo Complete ===\n");
+  return failures;
+}
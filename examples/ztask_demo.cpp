@@ -3,6 +3,11 @@
  * @brief FCCU + ztask periodic scheduling demo.
  *
  * Demonstrates ProcessFaults() driven by ztask cooperative scheduler.
+ * Each tick drains a bounded number of entries so that a fault storm
+ * cannot overrun the scheduler tick. Fault timestamps come from a
+ * TickClock advanced once per scheduler tick, so the report path does not
+ * read the system clock. The same tick drives the re-check timer wheel:
+ * fault 3 asks to be re-checked 5 ms later instead of being re-reported.
  */
 
 #include "fccu/fccu.hpp"
@@ -10,15 +15,28 @@
 
 #include <cstdio>
 
-static fccu::FaultCollector<8, 16>* g_collector = nullptr;
+// 1 scheduler tick = 1 ms of cached time
+static constexpr uint32_t kTickUs = 1000U;
+
+struct DemoPolicy : fccu::DefaultCollectorPolicy {
+  using Clock = fccu::TickClock;
+  using DeferTimer = fccu::DeferTimerWheel<16U, kTickUs>;
+};
+using DemoCollector = fccu::FaultCollector<8, 16, 4, 8, 1, DemoPolicy>;
+
+static DemoCollector* g_collector = nullptr;
 static uint32_t g_tick_count = 0U;
 
+// Per-tick consumer budget
+static constexpr uint32_t kMaxFaultsPerTick = 8U;
+static constexpr uint32_t kMaxUsPerTick = 200U;
+
 // ztask callback: periodic fault processing
 static void FaultProcessTask(void* /*ctx*/) {
   if (g_collector == nullptr) {
     return;
   }
-  uint32_t n = g_collector->ProcessFaults();
+  uint32_t n = g_collector->ProcessFaults(kMaxFaultsPerTick, kMaxUsPerTick);
   if (n > 0U) {
     std::printf("  [ztask tick=%u] Processed %u faults\n", g_tick_count, n);
   }
@@ -37,8 +55,15 @@ static void FaultInjector(void* /*ctx*/) {
 }
 
 static fccu::HookAction DemoHook(const fccu::FaultEvent& event, void* /*ctx*/) {
-  std::printf("    [hook] fault_index=%u code=0x%04x detail=0x%x -> HANDLED\n", event.fault_index, event.fault_code,
-              event.detail);
+  if (event.fault_index == 3U && !event.is_recheck) {
+    std::printf("    [hook] fault_index=%u code=0x%04x detail=0x%x t=%lu us -> DEFER 5 ms\n", event.fault_index,
+                event.fault_code, event.detail, static_cast<unsigned long>(event.timestamp_us));
+    g_collector->RequestRecheck(event.fault_index, 5000U);
+    return fccu::HookAction::kDefer;
+  }
+  std::printf("    [hook] fault_index=%u code=0x%04x detail=0x%x t=%lu us%s -> HANDLED\n", event.fault_index,
+              event.fault_code, event.detail, static_cast<unsigned long>(event.timestamp_us),
+              event.is_recheck ? " (re-check)" : "");
   return fccu::HookAction::kHandled;
 }
 
@@ -46,7 +71,7 @@ int main() {
   std::printf("=== FCCU + ztask Demo ===\n\n");
 
   // Create collector
-  fccu::FaultCollector<8, 16> collector;
+  DemoCollector collector;
   g_collector = &collector;
 
   // Register faults
@@ -65,6 +90,7 @@ int main() {
   std::printf("--- Running %u ticks ---\n", 50U);
   for (uint32_t t = 0U; t < 50U; ++t) {
     g_tick_count = t;
+    fccu::TickClock::Advance(kTickUs);
     scheduler.Tick();
     scheduler.Poll();
   }
@@ -74,6 +100,7 @@ int main() {
   std::printf("\n--- Final Statistics ---\n");
   std::printf("Reported: %lu  Processed: %lu  Dropped: %lu\n", stats.total_reported, stats.total_processed,
               stats.total_dropped);
+  std::printf("Re-checked: %lu  Pending re-checks: %u\n", stats.total_rechecked, collector.PendingRecheckCount());
   std::printf("Active faults: %u\n", collector.ActiveFaultCount());
   std::printf("Global HSM: %s\n", collector.GetGlobalHsm().CurrentStateName());
 
@@ -6,8 +6,17 @@
  * Higher priority queues (lower index) are drained first.
  *
  * Design patterns from newosp fault_collector.hpp:
- * - Priority admission control (60%/80%/99% thresholds)
+ * - Priority admission control (60%/80%/99% thresholds by default,
+ *   replaceable through the Admission policy, with a throttled table)
  * - Per-priority queue depth monitoring
+ *
+ * Multi-producer support is provided by sharding, not by CAS: each producer
+ * registers its own lane (one SPSC ringbuffer per level), and the single
+ * consumer merges the lanes level by level.
+ *
+ * Level selection uses a producer-published non-empty bitmask: the consumer
+ * finds the highest non-empty level with one load and a count-trailing-zeros
+ * instead of probing every ringbuffer's head index.
  */
 
 #ifndef FCCU_FAULT_QUEUE_SET_HPP_
@@ -18,9 +27,73 @@
 #include <cstdint>
 
 #include <array>
+#include <atomic>
 
 namespace fccu {
 
+namespace detail {
+
+inline uint32_t CountTrailingZeros32(uint32_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<uint32_t>(__builtin_ctz(x));
+#else
+  uint32_t n = 0U;
+  while ((x & 1U) == 0U) {
+    x >>= 1U;
+    ++n;
+  }
+  return n;
+#endif
+}
+
+}  // namespace detail
+
+// ============================================================================
+// Admission Policies
+// ============================================================================
+
+/**
+ * @brief Default admission thresholds (newosp pattern).
+ *
+ * An admission policy provides
+ *   static constexpr uint32_t FillLimitPercent(uint32_t level, bool throttled);
+ * returning how full (percent of LevelSize, per lane) a level may be for a
+ * new item to still be admitted. The throttled table applies while the
+ * queue set is throttled (e.g. FCCU in Degraded state).
+ *
+ * Normal:    Critical 100%, High 99%, Medium 80%, Low 60%
+ * Throttled: Critical 100%, High 99%, Medium 40%, Low 30%
+ */
+struct DefaultAdmissionPolicy {
+  static constexpr uint32_t FillLimitPercent(uint32_t level, bool throttled) noexcept {
+    if (level == 0U) {
+      return 100U;
+    }
+    if (level == 1U) {
+      return 99U;
+    }
+    if (level == 2U) {
+      return throttled ? 40U : 80U;
+    }
+    return throttled ? 30U : 60U;
+  }
+};
+
+namespace detail {
+
+/** @brief Per-level absolute admission limits, evaluated at compile time. */
+template <typename Admission, uint32_t Levels, uint32_t LevelSize>
+constexpr std::array<uint32_t, Levels> MakeAdmissionLimits(bool throttled) noexcept {
+  std::array<uint32_t, Levels> limits{};
+  for (uint32_t level = 0U; level < Levels; ++level) {
+    uint32_t pct = Admission::FillLimitPercent(level, throttled);
+    limits[level] = (LevelSize * ((pct < 100U) ? pct : 100U)) / 100U;
+  }
+  return limits;
+}
+
+}  // namespace detail
+
 // ============================================================================
 // FaultQueueSet - Multi-level SPSC Priority Queue Set
 // ============================================================================
@@ -30,25 +103,45 @@ namespace fccu {
  *
  * @tparam T         Element type (must be trivially copyable)
  * @tparam Levels    Number of priority levels (default: 4)
- * @tparam LevelSize Capacity per level (must be power of 2, default: 32)
+ * @tparam LevelSize Capacity per level and lane (must be power of 2, default: 32)
+ * @tparam Lanes     Number of producer lanes (1..32, default: 1)
+ * @tparam Admission Admission threshold policy (default: DefaultAdmissionPolicy)
  *
  * Priority convention: level 0 = highest priority (Critical),
  * level Levels-1 = lowest priority (Low).
  *
- * Thread safety: exactly one producer thread, one consumer thread (SPSC).
+ * Thread safety: one producer thread per lane, one consumer thread.
+ * The lane-less Push overloads use lane 0 and are meant for the classic
+ * single-producer setup. With Lanes > 1, every producer thread claims its
+ * own lane via RegisterProducer() and uses the lane overloads; pushes stay
+ * wait-free because no two threads ever write the same ringbuffer. Lane 0
+ * is then never handed out, so the lane-less path keeps it to itself.
  */
-template <typename T, uint32_t Levels = 4U, uint32_t LevelSize = 32U>
+template <typename T, uint32_t Levels = 4U, uint32_t LevelSize = 32U, uint32_t Lanes = 1U,
+          typename Admission = DefaultAdmissionPolicy>
 class FaultQueueSet {
   static_assert(Levels > 0U && Levels <= 8U, "Levels must be 1..8");
   static_assert(LevelSize > 0U && (LevelSize & (LevelSize - 1U)) == 0U, "LevelSize must be power of 2");
+  static_assert(Lanes > 0U && Lanes <= 32U, "Lanes must be 1..32");
 
  public:
   using IndexT = std::size_t;
 
-  // --- Priority Admission Thresholds (from newosp pattern) ---
-  static constexpr uint32_t kLowThreshold = (LevelSize * 60U) / 100U;     ///< 60% full
-  static constexpr uint32_t kMediumThreshold = (LevelSize * 80U) / 100U;  ///< 80% full
-  static constexpr uint32_t kHighThreshold = (LevelSize * 99U) / 100U;    ///< 99% full
+  static constexpr uint8_t kInvalidLane = 0xFFU;
+  /// Lane 0 stays with the lane-less overloads whenever there is more than one lane
+  static constexpr uint8_t kFirstClaimableLane = (Lanes > 1U) ? 1U : 0U;
+  static constexpr uint32_t kClaimableLanes = Lanes - kFirstClaimableLane;
+
+  // --- Priority Admission Thresholds (from the Admission policy) ---
+  using AdmissionPolicy = Admission;
+  static constexpr std::array<uint32_t, Levels> kAdmitLimit =
+      detail::MakeAdmissionLimits<Admission, Levels, LevelSize>(false);  ///< Depth below which a level admits
+  static constexpr std::array<uint32_t, Levels> kThrottledAdmitLimit =
+      detail::MakeAdmissionLimits<Admission, Levels, LevelSize>(true);  ///< Same, while throttled
+
+  static constexpr uint32_t kLowThreshold = (LevelSize * Admission::FillLimitPercent(3U, false)) / 100U;
+  static constexpr uint32_t kMediumThreshold = (LevelSize * Admission::FillLimitPercent(2U, false)) / 100U;
+  static constexpr uint32_t kHighThreshold = (LevelSize * Admission::FillLimitPercent(1U, false)) / 100U;
 
   /**
    * @brief Push an item into the specified priority level queue.
@@ -56,62 +149,292 @@ class FaultQueueSet {
    * @param item  Item to enqueue
    * @return true if successfully enqueued, false if queue full or invalid level
    */
-  bool Push(uint8_t level, const T& item) noexcept {
-    if (level >= Levels) {
+  bool Push(uint8_t level, const T& item) noexcept { return Push(0U, level, item); }
+
+  /**
+   * @brief Push an item into the given producer lane.
+   * @param lane  Producer lane (claimed via RegisterProducer)
+   * @param level Priority level (0 = highest)
+   * @param item  Item to enqueue
+   * @return true if successfully enqueued, false if queue full or invalid lane/level
+   */
+  bool Push(uint8_t lane, uint8_t level, const T& item) noexcept {
+    if (level >= Levels || lane >= Lanes) {
       return false;
     }
-    return queues_[level].Push(item);
+    if (!queues_[level][lane].Push(item)) {
+      return false;
+    }
+    MarkNonEmpty(level);
+    return true;
   }
 
   /**
    * @brief Push with priority admission control (newosp pattern).
    *
-   * Admission thresholds based on the target queue's fill level:
+   * Admission thresholds based on the target queue's fill level, per the
+   * Admission policy (defaults):
    * - Critical (level 0): always admit if physically possible
    * - High (level 1): admit if queue < 99% full
-   * - Medium (level 2): admit if queue < 80% full
-   * - Low (level 3+): admit if queue < 60% full
+   * - Medium (level 2): admit if queue < 80% full (40% while throttled)
+   * - Low (level 3+): admit if queue < 60% full (30% while throttled)
    *
    * @param level Priority level (0 = highest)
    * @param item  Item to enqueue
    * @return true if admitted and enqueued
    */
-  bool PushWithAdmission(uint8_t level, const T& item) noexcept {
-    if (level >= Levels) {
+  bool PushWithAdmission(uint8_t level, const T& item) noexcept { return PushWithAdmission(0U, level, item); }
+
+  /**
+   * @brief Push with priority admission control into the given producer lane.
+   *
+   * Admission is evaluated against the fill level of the producer's own lane,
+   * so one flooding producer cannot starve the others.
+   *
+   * @param[out] out_was_empty Optional: set to true if this push turned the
+   *                           whole set from empty to non-empty (wakeup hint)
+   */
+  bool PushWithAdmission(uint8_t lane, uint8_t level, const T& item, bool* out_was_empty = nullptr) noexcept {
+    if (level >= Levels || lane >= Lanes) {
       return false;
     }
-    if (!AdmitByPriority(level, static_cast<uint32_t>(queues_[level].Size()))) {
+    auto& queue = queues_[level][lane];
+    if (!AdmitByPriority(level, static_cast<uint32_t>(queue.Size()))) {
       return false;
     }
-    return queues_[level].Push(item);
+    if (!queue.Push(item)) {
+      return false;
+    }
+    bool was_empty = MarkNonEmpty(level);
+    if (out_was_empty != nullptr) {
+      *out_was_empty = was_empty;
+    }
+    return true;
+  }
+
+  /**
+   * @brief Bulk push into one level of a producer lane.
+   * @return Number of leading items enqueued (the rest did not fit)
+   */
+  IndexT PushBatch(uint8_t lane, uint8_t level, const T* items, IndexT count) noexcept {
+    if (level >= Levels || lane >= Lanes || items == nullptr) {
+      return 0;
+    }
+    IndexT n = queues_[level][lane].PushBatch(items, count);
+    if (n > 0U) {
+      MarkNonEmpty(level);
+    }
+    return n;
+  }
+
+  /**
+   * @brief Bulk push with priority admission control.
+   *
+   * Admits the same leading items that count successive PushWithAdmission()
+   * calls would, but with a single admission check and a single ringbuffer
+   * publish.
+   *
+   * @param[out] out_was_empty Optional: set to true if this push turned the
+   *                           whole set from empty to non-empty (untouched otherwise)
+   * @return Number of leading items enqueued (the rest were refused)
+   */
+  IndexT PushBatchWithAdmission(uint8_t lane, uint8_t level, const T* items, IndexT count,
+                                bool* out_was_empty = nullptr) noexcept {
+    if (level >= Levels || lane >= Lanes || items == nullptr) {
+      return 0;
+    }
+    auto& queue = queues_[level][lane];
+    IndexT headroom = AdmissionHeadroom(level, static_cast<uint32_t>(queue.Size()));
+    if (headroom == 0U) {
+      return 0;
+    }
+    IndexT n = queue.PushBatch(items, (count < headroom) ? count : headroom);
+    if (n > 0U && MarkNonEmpty(level) && out_was_empty != nullptr) {
+      *out_was_empty = true;
+    }
+    return n;
   }
 
   /**
    * @brief Pop the highest-priority available item.
    *
-   * Scans from level 0 (highest) to level Levels-1 (lowest), returning
-   * the first available item.
+   * Selects the highest level whose non-empty bit is set, returning the
+   * first available item. Lanes within a level are visited round-robin
+   * so that no producer can monopolize a level. An empty poll costs a
+   * single load of the non-empty mask.
    *
    * @param[out] item      Popped item
    * @param[out] out_level Priority level of the popped item
    * @return true if an item was dequeued
    */
   bool Pop(T& item, uint8_t& out_level) noexcept {
-    for (uint8_t i = 0U; i < static_cast<uint8_t>(Levels); ++i) {
-      if (queues_[i].Pop(item)) {
-        out_level = i;
+    uint32_t mask = nonempty_mask_.load(std::memory_order_acquire);
+    while (mask != 0U) {
+      uint8_t level = static_cast<uint8_t>(detail::CountTrailingZeros32(mask));
+      if (PopLevel(level, item)) {
+        out_level = level;
         return true;
       }
+      if (!SettleEmptyLevel(level)) {
+        mask &= ~(1U << level);
+      }
     }
     return false;
   }
 
+  /**
+   * @brief Pop a contiguous block from the highest-priority non-empty level.
+   *
+   * The block comes from a single lane of a single level, so a caller
+   * re-selects the level between blocks and a newly arrived higher-priority
+   * item waits at most one block.
+   *
+   * @param[out] items     Destination buffer (at least max_count elements)
+   * @param max_count      Maximum number of items to pop
+   * @param[out] out_level Priority level of the popped block
+   * @return Number of items popped (0 if all queues are empty)
+   */
+  IndexT PopBatch(T* items, IndexT max_count, uint8_t& out_level) noexcept {
+    if (items == nullptr || max_count == 0U) {
+      return 0;
+    }
+    uint32_t mask = nonempty_mask_.load(std::memory_order_acquire);
+    while (mask != 0U) {
+      uint8_t level = static_cast<uint8_t>(detail::CountTrailingZeros32(mask));
+      IndexT n = PopLevelBatch(level, items, max_count);
+      if (n > 0U) {
+        out_level = level;
+        return n;
+      }
+      if (!SettleEmptyLevel(level)) {
+        mask &= ~(1U << level);
+      }
+    }
+    return 0;
+  }
+
+  /**
+   * @brief Pop overdue items from below the highest non-empty level (aging).
+   *
+   * Strict priority serves the highest non-empty level anyway, so only the
+   * levels below it are visited, most urgent first. Lanes are visited from
+   * the level's round-robin cursor, which moves past the lane served, so a
+   * storm on one lane cannot starve overdue items on the others. Leading
+   * items of the first lane whose head satisfies is_due(item, level) are
+   * popped for as long as they do. Consumer only; each call costs one head
+   * peek per non-empty lower level and lane.
+   *
+   * @param is_due         bool(const T& item, uint8_t level)
+   * @param[out] out_level Priority level of the popped block
+   * @return Number of items popped (0 if nothing is overdue)
+   */
+  template <typename IsDue>
+  IndexT PopOverdueBatch(T* items, IndexT max_count, uint8_t& out_level, IsDue&& is_due) noexcept {
+    if (items == nullptr || max_count == 0U) {
+      return 0;
+    }
+    uint32_t mask = nonempty_mask_.load(std::memory_order_acquire);
+    if (mask != 0U) {
+      mask &= mask - 1U;
+    }
+    for (; mask != 0U; mask &= mask - 1U) {
+      uint8_t level = static_cast<uint8_t>(detail::CountTrailingZeros32(mask));
+      const uint32_t start = lane_cursor_[level];
+      for (uint32_t k = 0U; k < Lanes; ++k) {
+        const uint32_t lane = (start + k) % Lanes;
+        auto& queue = queues_[level][lane];
+        IndexT n = 0;
+        for (T* head = queue.Peek(); n < max_count && head != nullptr && is_due(*head, level); head = queue.Peek()) {
+          items[n++] = *head;
+          (void)queue.Discard(1U);
+        }
+        if (n > 0U) {
+          lane_cursor_[level] = static_cast<uint8_t>((lane + 1U) % Lanes);
+          out_level = level;
+          return n;
+        }
+      }
+    }
+    return 0;
+  }
+
+  // --- Producer lane management ---
+
+  /**
+   * @brief Claim a free producer lane (never lane 0 when Lanes > 1).
+   * @param[out] out_lane Claimed lane index, kInvalidLane on failure
+   * @return true if a lane was claimed, false if all lanes are taken
+   */
+  bool RegisterProducer(uint8_t& out_lane) noexcept {
+    uint32_t mask = lane_mask_.load(std::memory_order_relaxed);
+    for (;;) {
+      uint8_t lane = kInvalidLane;
+      for (uint8_t i = kFirstClaimableLane; i < static_cast<uint8_t>(Lanes); ++i) {
+        if ((mask & (1U << i)) == 0U) {
+          lane = i;
+          break;
+        }
+      }
+      if (lane == kInvalidLane) {
+        out_lane = kInvalidLane;
+        return false;
+      }
+      if (lane_mask_.compare_exchange_weak(mask, mask | (1U << lane), std::memory_order_acq_rel,
+                                           std::memory_order_relaxed)) {
+        out_lane = lane;
+        return true;
+      }
+    }
+  }
+
+  /**
+   * @brief Release a previously claimed producer lane.
+   *
+   * Items still queued in the lane remain visible to the consumer.
+   */
+  void ReleaseProducer(uint8_t lane) noexcept {
+    if (lane >= kFirstClaimableLane && lane < Lanes) {
+      lane_mask_.fetch_and(~(1U << lane), std::memory_order_acq_rel);
+    }
+  }
+
+  /**
+   * @brief Number of currently claimed producer lanes.
+   */
+  uint32_t ProducerCount() const noexcept {
+    uint32_t mask = lane_mask_.load(std::memory_order_relaxed);
+    uint32_t count = 0U;
+    for (; mask != 0U; mask &= mask - 1U) {
+      ++count;
+    }
+    return count;
+  }
+
+  /**
+   * @brief Switch producers to the throttled admission table (any thread).
+   *
+   * Producers pick the change up on their next admission check; entries
+   * already queued are unaffected.
+   */
+  void SetThrottled(bool throttled) noexcept { throttled_.store(throttled, std::memory_order_relaxed); }
+
+  bool IsThrottled() const noexcept { return throttled_.load(std::memory_order_relaxed); }
+
+  /** @brief Depth below which a level currently admits new items. */
+  uint32_t AdmitLimit(uint8_t level) const noexcept {
+    if (level >= Levels) {
+      return 0U;
+    }
+    return IsThrottled() ? kThrottledAdmitLimit[level] : kAdmitLimit[level];
+  }
+
   /**
    * @brief Check if all queues are empty.
    */
   bool IsEmpty() const noexcept {
-    for (uint32_t i = 0U; i < Levels; ++i) {
-      if (!queues_[i].IsEmpty()) {
+    uint32_t mask = nonempty_mask_.load(std::memory_order_acquire);
+    for (; mask != 0U; mask &= mask - 1U) {
+      if (LevelHasItems(static_cast<uint8_t>(detail::CountTrailingZeros32(mask)))) {
         return false;
       }
     }
@@ -119,38 +442,75 @@ class FaultQueueSet {
   }
 
   /**
-   * @brief Get the current size of a specific priority level queue.
+   * @brief Snapshot of the non-empty level hint (bit i = level i may hold items).
+   *
+   * Bits are set by producers after each push and cleared lazily by the
+   * consumer, so a set bit may be stale but a queued item always has its
+   * bit set once the pushing call has returned.
+   */
+  uint32_t NonEmptyMask() const noexcept { return nonempty_mask_.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Get the current size of a specific priority level (all lanes).
    */
   IndexT Size(uint8_t level) const noexcept {
     if (level >= Levels) {
       return 0;
     }
-    return queues_[level].Size();
+    IndexT total = 0;
+    for (uint32_t j = 0U; j < Lanes; ++j) {
+      total += queues_[level][j].Size();
+    }
+    return total;
   }
 
   /**
-   * @brief Get total items across all priority levels.
+   * @brief Get the current size of a specific priority level in one lane.
+   */
+  IndexT Size(uint8_t lane, uint8_t level) const noexcept {
+    if (level >= Levels || lane >= Lanes) {
+      return 0;
+    }
+    return queues_[level][lane].Size();
+  }
+
+  /**
+   * @brief Get total items across all priority levels and lanes.
    */
   IndexT TotalSize() const noexcept {
     IndexT total = 0;
     for (uint32_t i = 0U; i < Levels; ++i) {
-      total += queues_[i].Size();
+      total += Size(static_cast<uint8_t>(i));
     }
     return total;
   }
 
   /**
-   * @brief Get available slots in a specific priority level queue.
+   * @brief Get available slots in a specific priority level (all lanes).
    */
   IndexT Available(uint8_t level) const noexcept {
     if (level >= Levels) {
       return 0;
     }
-    return queues_[level].Available();
+    IndexT total = 0;
+    for (uint32_t j = 0U; j < Lanes; ++j) {
+      total += queues_[level][j].Available();
+    }
+    return total;
   }
 
   /**
-   * @brief Capacity per level (compile-time constant).
+   * @brief Get available slots in a specific priority level of one lane.
+   */
+  IndexT Available(uint8_t lane, uint8_t level) const noexcept {
+    if (level >= Levels || lane >= Lanes) {
+      return 0;
+    }
+    return queues_[level][lane].Available();
+  }
+
+  /**
+   * @brief Capacity per level and lane (compile-time constant).
    */
   static constexpr uint32_t Capacity() noexcept { return LevelSize; }
 
@@ -159,30 +519,120 @@ class FaultQueueSet {
    */
   static constexpr uint32_t LevelCount() noexcept { return Levels; }
 
+  /**
+   * @brief Number of producer lanes (compile-time constant).
+   */
+  static constexpr uint32_t LaneCount() noexcept { return Lanes; }
+
  private:
   /**
    * @brief Priority-based admission control (newosp pattern).
    *
-   * @param level         Priority level
+   * One relaxed load of the throttle flag plus a compile-time table lookup.
+   *
+   * @param level         Priority level (validated by the caller)
    * @param current_depth Current queue depth for this level
    * @return true if the item should be admitted
    */
-  static bool AdmitByPriority(uint8_t level, uint32_t current_depth) noexcept {
-    // Critical: always admit if physically possible
-    if (level == 0U) {
-      return true;
+  bool AdmitByPriority(uint8_t level, uint32_t current_depth) const noexcept {
+    return current_depth < AdmitLimit(level);
+  }
+
+  /** @brief Number of items AdmitByPriority() would still accept at this depth. */
+  IndexT AdmissionHeadroom(uint8_t level, uint32_t current_depth) const noexcept {
+    uint32_t limit = AdmitLimit(level);
+    return (current_depth < limit) ? (limit - current_depth) : 0U;
+  }
+
+  /**
+   * @brief Publish the level bit after a push; the RMW only runs when the bit is clear.
+   *
+   * Steady-state pushes into an already marked level just read the shared
+   * mask line instead of bouncing it between producer lanes. The fence
+   * orders the push before that read, pairing with the fence in
+   * SettleEmptyLevel(): the consumer either sees the pushed item or this
+   * read sees its clear.
+   * @return true if the mask was 0 before, i.e. the set went from empty to non-empty
+   */
+  bool MarkNonEmpty(uint8_t level) noexcept {
+    const uint32_t bit = 1U << level;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const uint32_t mask = nonempty_mask_.load(std::memory_order_relaxed);
+    if ((mask & bit) != 0U) {
+      return false;
     }
-    if (level == 1U) {
-      return current_depth < kHighThreshold;  // < 99%
+    return nonempty_mask_.fetch_or(bit, std::memory_order_acq_rel) == 0U;
+  }
+
+  bool LevelHasItems(uint8_t level) const noexcept {
+    for (uint32_t j = 0U; j < Lanes; ++j) {
+      if (!queues_[level][j].IsEmpty()) {
+        return true;
+      }
     }
-    if (level == 2U) {
-      return current_depth < kMediumThreshold;  // < 80%
+    return false;
+  }
+
+  /**
+   * @brief Clear the non-empty bit of a level the consumer found empty.
+   *
+   * A producer may push between the empty observation and the clear, so the
+   * level is re-checked after clearing. MarkNonEmpty() skips the RMW when it
+   * reads the bit set, so both sides fence between their write (clear / push)
+   * and their read (re-check / mask load): either the producer reads the
+   * cleared bit and sets it again, or our re-check observes its push and
+   * restores the bit.
+   *
+   * @return true if items arrived meanwhile and the level should be retried
+   */
+  bool SettleEmptyLevel(uint8_t level) noexcept {
+    nonempty_mask_.fetch_and(~(1U << level), std::memory_order_acq_rel);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!LevelHasItems(level)) {
+      return false;
+    }
+    MarkNonEmpty(level);
+    return true;
+  }
+
+  /** @brief Pop one item from a level, visiting lanes round-robin. */
+  bool PopLevel(uint8_t level, T& item) noexcept {
+    if (Lanes == 1U) {
+      return queues_[level][0].Pop(item);
+    }
+    uint32_t start = lane_cursor_[level];
+    for (uint32_t k = 0U; k < Lanes; ++k) {
+      uint32_t lane = (start + k) % Lanes;
+      if (queues_[level][lane].Pop(item)) {
+        lane_cursor_[level] = static_cast<uint8_t>((lane + 1U) % Lanes);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /** @brief Pop a block from the next non-empty lane of a level. */
+  IndexT PopLevelBatch(uint8_t level, T* items, IndexT max_count) noexcept {
+    if (Lanes == 1U) {
+      return queues_[level][0].PopBatch(items, max_count);
+    }
+    uint32_t start = lane_cursor_[level];
+    for (uint32_t k = 0U; k < Lanes; ++k) {
+      uint32_t lane = (start + k) % Lanes;
+      IndexT n = queues_[level][lane].PopBatch(items, max_count);
+      if (n > 0U) {
+        lane_cursor_[level] = static_cast<uint8_t>((lane + 1U) % Lanes);
+        return n;
+      }
     }
-    // Low priority (level 3+)
-    return current_depth < kLowThreshold;  // < 60%
+    return 0;
   }
 
-  std::array<spsc::Ringbuffer<T, LevelSize>, Levels> queues_;
+  std::array<std::array<spsc::Ringbuffer<T, LevelSize>, Lanes>, Levels> queues_;
+  alignas(64) std::atomic<uint32_t> nonempty_mask_{0U};  ///< Bit i set: level i may hold items
+  std::array<uint8_t, Levels> lane_cursor_{};             ///< Consumer-only round-robin cursor
+  alignas(64) std::atomic<uint32_t> lane_mask_{0U};       ///< Claimed producer lanes
+  std::atomic<bool> throttled_{false};                    ///< Read-mostly, shares the config line
 };
 
 }  // namespace fccu
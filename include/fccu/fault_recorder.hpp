@@ -0,0 +1,329 @@
+/**
+ * @file fault_recorder.hpp
+ * @brief Crash-safe black-box recorder: FaultEvents streamed into a memory-mapped ring.
+ *
+ * File / region layout (kRecorderVersion 1, little-endian):
+ *
+ *   offset 0     RecorderHeader (64 bytes: magic, version, record size, capacity, header CRC,
+ *                committed sequence)
+ *   offset 64    RecordedFault[capacity], slot = seq % capacity
+ *
+ * Every RecordedFault carries its own sequence number and a CRC-32 over
+ * the rest of the record, so a record torn by a crash or power loss is
+ * simply skipped by the reader; nothing else depends on it. The consumer
+ * writes records into the mapping with plain stores (no syscalls, never
+ * blocks) and publishes the committed sequence once per ProcessFaults()
+ * call. Flush() also schedules writeback with msync(MS_ASYNC).
+ *
+ * Readers (ForEachRecorded(), tools/fccu_recorder_dump) trust only the
+ * per-record sequence and CRC, not the header's committed sequence.
+ */
+
+#ifndef FCCU_FAULT_RECORDER_HPP_
+#define FCCU_FAULT_RECORDER_HPP_
+
+#include "fccu/fccu.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <array>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define FCCU_RECORDER_POSIX 1
+#endif
+
+namespace fccu {
+
+static constexpr uint32_t kRecorderMagic = 0x42524346U;  ///< "FCRB" little-endian
+static constexpr uint16_t kRecorderVersion = 1U;
+
+/** @brief Region header; all fields but committed_seq are written once at initialisation. */
+struct RecorderHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t record_size;
+  uint32_t capacity;
+  uint32_t header_crc;     ///< CRC-32 of the four fields above
+  uint64_t committed_seq;  ///< Records [0, committed_seq) were flushed (hint only)
+  uint64_t reserved[5];
+};
+
+/** @brief One recorded FaultEvent (40 bytes). */
+struct RecordedFault {
+  uint64_t seq;
+  uint64_t timestamp_us;
+  uint32_t fault_code;
+  uint32_t detail;
+  uint32_t occurrence_count;
+  uint32_t coalesced_count;
+  FaultIndex fault_index;
+  uint8_t priority;  ///< FaultPriority
+  uint8_t flags;     ///< kRecordFirst
+  uint32_t crc;      ///< CRC-32 of all preceding bytes
+};
+
+static constexpr uint8_t kRecordFirst = 0x01U;  ///< RecordedFault::flags: FaultEvent::is_first
+
+static_assert(sizeof(RecorderHeader) == 64U, "RecorderHeader layout changed: bump kRecorderVersion");
+static_assert(sizeof(RecordedFault) == 40U, "RecordedFault layout changed: bump kRecorderVersion");
+
+namespace detail {
+
+struct Crc32Table {
+  std::array<uint32_t, 256> t{};
+  constexpr Crc32Table() noexcept {
+    for (uint32_t i = 0U; i < 256U; ++i) {
+      uint32_t c = i;
+      for (uint32_t k = 0U; k < 8U; ++k) {
+        c = (c & 1U) ? (0xEDB88320U ^ (c >> 1U)) : (c >> 1U);
+      }
+      t[i] = c;
+    }
+  }
+};
+
+inline constexpr Crc32Table kCrc32Table{};
+
+/** @brief CRC-32 (IEEE 802.3, reflected). */
+inline uint32_t Crc32(const void* data, size_t len) noexcept {
+  const auto* p = static_cast<const uint8_t*>(data);
+  uint32_t crc = 0xFFFFFFFFU;
+  for (size_t i = 0U; i < len; ++i) {
+    crc = kCrc32Table.t[(crc ^ p[i]) & 0xFFU] ^ (crc >> 8U);
+  }
+  return crc ^ 0xFFFFFFFFU;
+}
+
+inline uint32_t RecordCrc(const RecordedFault& rec) noexcept { return Crc32(&rec, offsetof(RecordedFault, crc)); }
+
+inline uint32_t HeaderCrc(const RecorderHeader& h) noexcept { return Crc32(&h, offsetof(RecorderHeader, header_crc)); }
+
+inline bool HeaderValid(const RecorderHeader& h, uint64_t region_size) noexcept {
+  return h.magic == kRecorderMagic && h.version == kRecorderVersion && h.record_size == sizeof(RecordedFault) &&
+         h.capacity != 0U && h.header_crc == HeaderCrc(h) &&
+         region_size >= sizeof(RecorderHeader) + static_cast<uint64_t>(h.capacity) * sizeof(RecordedFault);
+}
+
+/** @brief Highest sequence among records that pass their CRC; false when there is none. */
+inline bool ScanLastSeq(const RecorderHeader& h, const RecordedFault* records, uint64_t& out_seq) noexcept {
+  bool found = false;
+  for (uint32_t i = 0U; i < h.capacity; ++i) {
+    const RecordedFault& rec = records[i];
+    if (rec.crc == RecordCrc(rec) && rec.seq % h.capacity == i && (!found || rec.seq > out_seq)) {
+      out_seq = rec.seq;
+      found = true;
+    }
+  }
+  return found;
+}
+
+}  // namespace detail
+
+/** @brief Bytes needed for a recorder region of the given capacity. */
+constexpr uint64_t RecorderRegionSize(uint32_t capacity) noexcept {
+  return sizeof(RecorderHeader) + static_cast<uint64_t>(capacity) * sizeof(RecordedFault);
+}
+
+/**
+ * @brief Decode a recorder region: fn(const RecordedFault&) for each intact record, oldest first.
+ *
+ * Records that fail their CRC, or were overwritten by a later lap, are
+ * skipped (counted in out_skipped when given).
+ *
+ * @return Number of records delivered (0 if the header is invalid)
+ */
+template <typename Fn>
+uint32_t ForEachRecorded(const void* base, uint64_t size, Fn&& fn, uint32_t* out_skipped = nullptr) {
+  if (out_skipped != nullptr) {
+    *out_skipped = 0U;
+  }
+  if (base == nullptr || size < sizeof(RecorderHeader)) {
+    return 0U;
+  }
+  const auto& h = *static_cast<const RecorderHeader*>(base);
+  if (!detail::HeaderValid(h, size)) {
+    return 0U;
+  }
+  const auto* records = reinterpret_cast<const RecordedFault*>(static_cast<const uint8_t*>(base) + sizeof(h));
+  uint64_t last = 0U;
+  if (!detail::ScanLastSeq(h, records, last)) {
+    return 0U;
+  }
+  uint64_t first = (last + 1U > h.capacity) ? last + 1U - h.capacity : 0U;
+  uint32_t delivered = 0U;
+  for (uint64_t seq = first; seq <= last; ++seq) {
+    const RecordedFault& rec = records[seq % h.capacity];
+    if (rec.seq != seq || rec.crc != detail::RecordCrc(rec)) {
+      if (out_skipped != nullptr) {
+        ++*out_skipped;
+      }
+      continue;
+    }
+    fn(rec);
+    ++delivered;
+  }
+  return delivered;
+}
+
+// ============================================================================
+// FaultRecorder - consumer-side writer
+// ============================================================================
+
+/**
+ * @brief Streams processed FaultEvents into a recorder region.
+ *
+ * Attach() installs it as the collector's recorder stage; every call runs on
+ * the consumer thread. Reopening an existing region continues after its
+ * last intact record, so the history survives restarts and resets.
+ */
+class FaultRecorder {
+ public:
+  FaultRecorder() noexcept = default;
+  ~FaultRecorder() { Close(); }
+  FaultRecorder(const FaultRecorder&) = delete;
+  FaultRecorder& operator=(const FaultRecorder&) = delete;
+
+#if defined(FCCU_RECORDER_POSIX)
+  /**
+   * @brief Map (creating or resizing as needed) a ring file.
+   *
+   * An existing file with a valid header of the same capacity is resumed;
+   * anything else is reinitialised.
+   */
+  FccuError Open(const char* path, uint32_t capacity) noexcept {
+    if (base_ != nullptr || path == nullptr || capacity == 0U) {
+      return FccuError::kIoError;
+    }
+    const uint64_t size = RecorderRegionSize(capacity);
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+      return FccuError::kIoError;
+    }
+    struct stat st {};
+    void* mem = MAP_FAILED;
+    if (fstat(fd, &st) == 0 &&
+        (static_cast<uint64_t>(st.st_size) == size || ftruncate(fd, static_cast<off_t>(size)) == 0)) {
+      mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    (void)close(fd);
+    if (mem == MAP_FAILED) {
+      return FccuError::kIoError;
+    }
+    mapped_ = true;
+    Init(mem, size, capacity);
+    return FccuError::kOk;
+  }
+#endif
+
+  /** @brief Use caller-provided memory (e.g. a RAM section preserved across reset). */
+  FccuError OpenIn(void* base, uint64_t size) noexcept {
+    if (base_ != nullptr || base == nullptr || size < RecorderRegionSize(1U)) {
+      return FccuError::kIoError;
+    }
+    auto capacity = static_cast<uint32_t>((size - sizeof(RecorderHeader)) / sizeof(RecordedFault));
+    Init(base, RecorderRegionSize(capacity), capacity);
+    return FccuError::kOk;
+  }
+
+  void Close() noexcept {
+    if (base_ == nullptr) {
+      return;
+    }
+    Flush();
+#if defined(FCCU_RECORDER_POSIX)
+    if (mapped_) {
+      (void)munmap(base_, size_);
+    }
+#endif
+    base_ = nullptr;
+    records_ = nullptr;
+    mapped_ = false;
+  }
+
+  /** @brief Install as the collector's recorder stage (replaces any previous one). */
+  template <typename Collector>
+  void Attach(Collector& collector) noexcept {
+    collector.SetRecorder(&FaultRecorder::OnEvent, this, &FaultRecorder::OnFlush);
+  }
+
+  /** @brief Append one event (consumer thread); overwrites the oldest record when full. */
+  void Append(const FaultEvent& event) noexcept {
+    if (records_ == nullptr) {
+      return;
+    }
+    RecordedFault& rec = records_[next_seq_ % capacity_];
+    rec.seq = next_seq_;
+    rec.timestamp_us = event.timestamp_us;
+    rec.fault_code = event.fault_code;
+    rec.detail = event.detail;
+    rec.occurrence_count = event.occurrence_count;
+    rec.coalesced_count = event.coalesced_count;
+    rec.fault_index = event.fault_index;
+    rec.priority = static_cast<uint8_t>(event.priority);
+    rec.flags = event.is_first ? kRecordFirst : 0U;
+    rec.crc = detail::RecordCrc(rec);
+    ++next_seq_;
+  }
+
+  /** @brief Publish the committed sequence and schedule writeback (non-blocking). */
+  void Flush() noexcept {
+    if (base_ == nullptr || Header().committed_seq == next_seq_) {
+      return;
+    }
+    Header().committed_seq = next_seq_;
+#if defined(FCCU_RECORDER_POSIX)
+    if (mapped_) {
+      (void)msync(base_, size_, MS_ASYNC);
+    }
+#endif
+  }
+
+  bool IsOpen() const noexcept { return base_ != nullptr; }
+  uint32_t Capacity() const noexcept { return capacity_; }
+  uint64_t NextSeq() const noexcept { return next_seq_; }  ///< Sequence of the next record
+
+ private:
+  RecorderHeader& Header() noexcept { return *static_cast<RecorderHeader*>(base_); }
+
+  void Init(void* base, uint64_t size, uint32_t capacity) noexcept {
+    base_ = base;
+    size_ = size;
+    capacity_ = capacity;
+    records_ = reinterpret_cast<RecordedFault*>(static_cast<uint8_t*>(base) + sizeof(RecorderHeader));
+    RecorderHeader& h = Header();
+    uint64_t last = 0U;
+    if (detail::HeaderValid(h, size) && h.capacity == capacity) {
+      next_seq_ = detail::ScanLastSeq(h, records_, last) ? last + 1U : 0U;
+      return;
+    }
+    std::memset(base, 0, static_cast<size_t>(size));
+    h.magic = kRecorderMagic;
+    h.version = kRecorderVersion;
+    h.record_size = static_cast<uint16_t>(sizeof(RecordedFault));
+    h.capacity = capacity;
+    h.header_crc = detail::HeaderCrc(h);
+    h.committed_seq = 0U;
+    next_seq_ = 0U;
+  }
+
+  static void OnEvent(const FaultEvent& event, void* ctx) noexcept { static_cast<FaultRecorder*>(ctx)->Append(event); }
+
+  static void OnFlush(void* ctx) noexcept { static_cast<FaultRecorder*>(ctx)->Flush(); }
+
+  void* base_ = nullptr;
+  RecordedFault* records_ = nullptr;
+  uint64_t size_ = 0U;
+  uint64_t next_seq_ = 0U;
+  uint32_t capacity_ = 0U;
+  bool mapped_ = false;
+};
+
+}  // namespace fccu
+
+#endif  // FCCU_FAULT_RECORDER_HPP_
@@ -6,15 +6,22 @@
  * and control unit. Reuses proven patterns from newosp fault_collector.hpp
  * with external component integration (ringbuffer, hsm-cpp).
  *
- * Thread safety: SPSC model - one producer thread, one consumer thread.
- * For multi-producer scenarios, use mccc AsyncBus as the reporting front-end.
+ * Thread safety: one consumer thread, and either one producer thread or
+ * up to MaxProducers producer threads that each claim their own queue lane
+ * via RegisterProducer() and report through ReportFaultFrom().
+ * State machines are only touched by the consumer unless
+ * HsmDispatchMode::kOnReport is selected (the single-producer default).
  */
 
 #ifndef FCCU_FCCU_HPP_
 #define FCCU_FCCU_HPP_
 
 #include "fccu/fault_queue_set.hpp"
+#include "fccu/fccu_clock.hpp"
 #include "fccu/fccu_hsm.hpp"
+#include "fccu/latency_histogram.hpp"
+#include "fccu/seqlock.hpp"
+#include "fccu/timer_wheel.hpp"
 
 #include <cstdint>
 #include <cstdio>
@@ -23,6 +30,8 @@
 #include <array>
 #include <atomic>
 #include <chrono>
+#include <iterator>
+#include <type_traits>
 
 namespace fccu {
 
@@ -37,6 +46,30 @@ inline uint64_t SteadyNowUs() noexcept {
   return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(dur).count());
 }
 
+inline uint32_t CountTrailingZeros64(uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<uint32_t>(__builtin_ctzll(x));
+#else
+  uint32_t n = 0U;
+  while ((x & 1U) == 0U) {
+    x >>= 1U;
+    ++n;
+  }
+  return n;
+#endif
+}
+
+/** @brief Spin-wait hint (PAUSE / YIELD); a no-op where none exists. */
+inline void CpuRelax() noexcept {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#endif
+}
+
 inline uint32_t PopCount64(uint64_t x) noexcept {
 #if defined(__GNUC__) || defined(__clang__)
   return static_cast<uint32_t>(__builtin_popcountll(x));
@@ -54,8 +87,18 @@ inline uint32_t PopCount64(uint64_t x) noexcept {
 // Enumerations
 // ============================================================================
 
+/** @brief Fault point index type used by every entry, event and callback. */
+using FaultIndex = uint16_t;
+
 enum class FaultPriority : uint8_t { kCritical = 0U, kHigh = 1U, kMedium = 2U, kLow = 3U };
 
+/**
+ * @brief Hook verdict. kEscalate re-runs the hook at once with the priority
+ * raised one level (same entry and timestamp, no re-enqueue), until another
+ * verdict is returned; at kCritical it leaves the fault active like kDefer.
+ * kDefer leaves the fault active; a hook that wants to run again later calls
+ * FaultCollector::RequestRecheck() before returning it.
+ */
 enum class HookAction : uint8_t { kHandled = 0U, kEscalate = 1U, kDefer = 2U, kShutdown = 3U };
 
 enum class FccuError : uint8_t {
@@ -65,64 +108,212 @@ enum class FccuError : uint8_t {
   kAlreadyRegistered,
   kNotRegistered,
   kAdmissionDenied,
-  kHsmSlotFull
+  kHsmSlotFull,
+  kProducerSlotFull,
+  kShmUnavailable,     ///< Shared memory could not be created, opened or mapped
+  kShmLayoutMismatch,  ///< Region was built by an incompatible FaultCollector layout
+  kShmNotReady,        ///< Owner has not published the region yet (or has closed it)
+  kIoError             ///< File could not be opened, sized or mapped
 };
 
+/**
+ * @brief Where the GlobalHsm / PerFaultHsm report transitions are driven.
+ *
+ * kOnReport:  the producer dispatches kDetected / kFaultReported /
+ *             kCriticalDetected inside ReportFault (single producer only).
+ * kOnProcess: the producer only timestamps, enqueues and sets the active
+ *             bit; the consumer dispatches all transitions in queue order.
+ */
+enum class HsmDispatchMode : uint8_t { kOnReport = 0U, kOnProcess = 1U };
+
+/**
+ * @brief How refused reports are signalled.
+ *
+ * kImmediate: OverflowFn runs on the producer thread inside the failing report.
+ * kDeferred:  the producer only bumps a per-fault drop counter and a drop
+ *             bitmap; the next ProcessFaults() delivers a coalesced summary
+ *             (DeferredOverflowFn per fault and/or OverflowSummaryFn per batch)
+ *             on the consumer thread.
+ */
+enum class OverflowMode : uint8_t { kImmediate = 0U, kDeferred = 1U };
+
 enum class BackpressureLevel : uint8_t { kNormal = 0U, kWarning = 1U, kCritical = 2U, kFull = 3U };
 
 // ============================================================================
 // Data Structures
 // ============================================================================
 
+/** @brief FaultEntry::reserved flag: the entry owns its fault's coalescing counter. */
+static constexpr uint8_t kEntryCoalesceOwner = 0x01U;
+
+/**
+ * @brief Queued fault report; the default Policy::Entry (16 bytes).
+ *
+ * A Policy::Entry type provides Encode() (producer side, from a FaultEntry),
+ * Decode() and Timestamp() (consumer side, given the priority of the queue
+ * level, the collector epoch and the current Clock ticks) and kIndexLimit.
+ * FaultEntry is its own encoding.
+ */
 struct FaultEntry {
-  uint16_t fault_index = 0U;
+  static constexpr uint32_t kIndexLimit = 0x10000U;
+
+  FaultIndex fault_index = 0U;
   FaultPriority priority = FaultPriority::kMedium;
-  uint8_t reserved = 0U;
+  uint8_t reserved = 0U;  ///< kEntry* flags
   uint32_t detail = 0U;
-  uint64_t timestamp_us = 0U;
+  uint64_t timestamp = 0U;  ///< Raw Policy::Clock ticks, converted by the consumer
+
+  static FaultEntry Encode(const FaultEntry& entry, uint64_t /*epoch*/) noexcept { return entry; }
+  FaultEntry Decode(FaultPriority /*level_priority*/, uint64_t /*epoch*/, uint64_t /*now*/) const noexcept {
+    return *this;
+  }
+  uint64_t Timestamp(uint64_t /*epoch*/, uint64_t /*now*/) const noexcept { return timestamp; }
+};
+
+/**
+ * @brief Policy::Entry of 8 bytes: twice the entries per cache line, half the queue memory.
+ *
+ * - The priority is dropped: the consumer takes the priority of the queue
+ *   level. Exact with 4 levels; with fewer, priorities sharing the last
+ *   level are reported as that level's priority.
+ * - The timestamp is kept as 32 bits of Clock ticks since the collector
+ *   epoch and widened again against the consumer's clock. It is exact while
+ *   an entry waits less than 2^31 ticks (about 2.1 s with a nanosecond
+ *   SteadyClock, 35 minutes with a microsecond TickClock).
+ * - Only the low 16 bits of detail are kept.
+ * - Fault indices are limited to 15 bits (MaxFaults <= 32768); the top bit
+ *   carries kEntryCoalesceOwner.
+ * @code
+ * struct McuPolicy : fccu::DefaultCollectorPolicy {
+ *   using Entry = fccu::PackedFaultEntry;
+ * };
+ * @endcode
+ */
+struct PackedFaultEntry {
+  static constexpr uint32_t kIndexLimit = 0x8000U;
+  static constexpr uint16_t kOwnerBit = 0x8000U;
+
+  uint16_t index_flags = 0U;  ///< Fault index | kOwnerBit
+  uint16_t detail = 0U;       ///< Low 16 bits of the reported detail
+  uint32_t timestamp = 0U;    ///< Clock ticks since the collector epoch, modulo 2^32
+
+  static PackedFaultEntry Encode(const FaultEntry& entry, uint64_t epoch) noexcept {
+    PackedFaultEntry packed;
+    const bool owner = (entry.reserved & kEntryCoalesceOwner) != 0U;
+    packed.index_flags = static_cast<uint16_t>(entry.fault_index | (owner ? kOwnerBit : 0U));
+    packed.detail = static_cast<uint16_t>(entry.detail);
+    packed.timestamp = static_cast<uint32_t>(entry.timestamp - epoch);
+    return packed;
+  }
+
+  FaultEntry Decode(FaultPriority level_priority, uint64_t epoch, uint64_t now) const noexcept {
+    FaultEntry entry;
+    entry.fault_index = static_cast<FaultIndex>(index_flags & ~kOwnerBit);
+    entry.priority = level_priority;
+    entry.reserved = ((index_flags & kOwnerBit) != 0U) ? kEntryCoalesceOwner : 0U;
+    entry.detail = detail;
+    entry.timestamp = Timestamp(epoch, now);
+    return entry;
+  }
+
+  /** @brief Full Clock ticks: now minus the signed 32-bit age (a producer clock slightly ahead is fine). */
+  uint64_t Timestamp(uint64_t epoch, uint64_t now) const noexcept {
+    const auto age = static_cast<int32_t>(static_cast<uint32_t>(now - epoch) - timestamp);
+    return now - static_cast<uint64_t>(static_cast<int64_t>(age));
+  }
 };
+static_assert(sizeof(PackedFaultEntry) == 8U, "PackedFaultEntry must stay 8 bytes");
 
 struct FaultEvent {
-  uint16_t fault_index = 0U;
+  FaultIndex fault_index = 0U;
   FaultPriority priority = FaultPriority::kMedium;
   uint32_t fault_code = 0U;
   uint32_t detail = 0U;
   uint64_t timestamp_us = 0U;
   uint32_t occurrence_count = 0U;
+  uint32_t coalesced_count = 1U;  ///< Reports folded into this event (> 1 only with coalescing), 0 on a re-check
   bool is_first = false;
+  bool is_recheck = false;  ///< RequestRecheck() re-run: same report as before, nothing new was queued
 };
 
 struct FaultStatistics {
+  static constexpr uint32_t kMaxLevels = 8U;  ///< Upper bound of QueueLevels
+
   uint64_t total_reported = 0U;
   uint64_t total_processed = 0U;
   uint64_t total_dropped = 0U;
-  uint64_t priority_reported[4] = {};
-  uint64_t priority_dropped[4] = {};
+  uint64_t total_coalesced = 0U;  ///< Reports folded into an already pending entry
+  uint64_t total_escalated = 0U;  ///< kEscalate steps (one per level climbed)
+  uint64_t total_aged = 0U;       ///< Entries served ahead of strict priority by Policy::Aging
+  uint64_t total_rechecked = 0U;  ///< Hooks re-run by Policy::DeferTimer after RequestRecheck()
+  uint64_t priority_reported[kMaxLevels] = {};  ///< Indexed by queue level, QueueLevels entries used
+  uint64_t priority_dropped[kMaxLevels] = {};
+};
+
+/** @brief One element of a ReportFaults() batch. */
+struct FaultReport {
+  FaultIndex fault_index = 0U;
+  uint32_t detail = 0U;
+  FaultPriority priority = FaultPriority::kMedium;
+};
+
+/** @brief Outcome of a ReportFaults() batch. */
+struct FaultBatchResult {
+  uint32_t admitted = 0U;  ///< Entries enqueued
+  uint32_t dropped = 0U;   ///< Entries refused by admission control or a full queue
+  uint32_t rejected = 0U;  ///< Entries with an invalid or unregistered fault index
+  uint32_t coalesced = 0U;  ///< Entries folded into an already pending entry (no queue slot used)
+};
+
+/** @brief Drops collected since the previous deferred overflow delivery. */
+struct OverflowSummary {
+  uint32_t fault_count = 0U;  ///< Distinct faults with at least one drop
+  uint64_t drop_count = 0U;   ///< Total refused reports
 };
 
 struct RecentFaultInfo {
-  uint16_t fault_index = 0U;
+  FaultIndex fault_index = 0U;
   uint32_t detail = 0U;
   FaultPriority priority = FaultPriority::kMedium;
   uint64_t timestamp_us = 0U;
 };
 
+/** @brief One per-fault HSM as copied into a FaultCollector::StateSnapshot. */
+struct FaultHsmSnapshot {
+  FaultIndex fault_index = 0U;
+  FaultState state = FaultState::kDormant;
+  uint32_t occurrence_count = 0U;
+};
+
 // ============================================================================
 // Callback Types (function pointer + context, zero overhead)
 // ============================================================================
 
 using FaultHookFn = HookAction (*)(const FaultEvent& event, void* ctx);
-using OverflowFn = void (*)(uint16_t fault_index, FaultPriority priority, void* ctx);
+using OverflowFn = void (*)(FaultIndex fault_index, FaultPriority priority, void* ctx);
+using DeferredOverflowFn = void (*)(FaultIndex fault_index, uint32_t drop_count, void* ctx);
+using OverflowSummaryFn = void (*)(const OverflowSummary& summary, void* ctx);
 using ShutdownFn = void (*)(void* ctx);
 using BusNotifyFn = void (*)(const FaultEvent& event, void* ctx);
-using FaultReportFn = void (*)(uint16_t fault_index, uint32_t detail, FaultPriority priority, void* ctx);
+using BusFlushFn = void (*)(void* ctx);
+using RecordFn = void (*)(const FaultEvent& event, void* ctx);
+using RecordFlushFn = void (*)(void* ctx);
+
+/** @brief SetUplink() reason bits: why an event is forwarded to a parent collector. */
+static constexpr uint8_t kUplinkFirst = 0x01U;      ///< First occurrence since the fault was last cleared
+static constexpr uint8_t kUplinkConfirmed = 0x02U;  ///< occurrence_count reached the fault's threshold
+static constexpr uint8_t kUplinkEscalated = 0x04U;  ///< The hook returned kEscalate (event carries the final priority)
+
+using UplinkFn = void (*)(const FaultEvent& event, uint8_t reasons, void* ctx);
+using UplinkFlushFn = void (*)(void* ctx);
+using FaultReportFn = void (*)(FaultIndex fault_index, uint32_t detail, FaultPriority priority, void* ctx);
 
 /** @brief Lightweight fault reporter injection point (POD, 16 bytes). */
 struct FaultReporter {
   FaultReportFn fn = nullptr;
   void* ctx = nullptr;
 
-  void Report(uint16_t fault_index, uint32_t detail = 0U,
+  void Report(FaultIndex fault_index, uint32_t detail = 0U,
               FaultPriority priority = FaultPriority::kMedium) const noexcept {
     if (fn != nullptr) {
       fn(fault_index, detail, priority, ctx);
@@ -130,6 +321,350 @@ struct FaultReporter {
   }
 };
 
+// ============================================================================
+// Hook Dispatch (Policy::Hooks)
+// ============================================================================
+
+/** @brief Default Policy::Hooks: per-fault FaultHookFn table set by RegisterHook()/SetDefaultHook(). */
+struct RuntimeHooks {
+  static constexpr bool kStatic = false;
+
+  static constexpr uint32_t IndexBound() noexcept { return 0U; }
+};
+
+/**
+ * @brief Compile-time binding of one fault index to a hook function.
+ *
+ * @tparam Idx Fault index
+ * @tparam Fn  HookAction (*)(const FaultEvent&), called directly (inlinable)
+ */
+template <FaultIndex Idx, auto Fn>
+struct StaticHook {
+  static_assert(std::is_invocable_r_v<HookAction, decltype(Fn), const FaultEvent&>,
+                "StaticHook Fn must be callable as HookAction(const FaultEvent&)");
+  static constexpr FaultIndex kIndex = Idx;
+
+  static HookAction Call(const FaultEvent& event) noexcept { return Fn(event); }
+};
+
+/**
+ * @brief Policy::Hooks with the whole hook set fixed at build time.
+ *
+ * ProcessEntry() selects the handler by comparing against constant indices
+ * and calls it directly, with no table load, null check or indirect branch.
+ * Faults without a StaticHook go to DefaultFn, or count as kHandled when
+ * DefaultFn is nullptr (same as having no runtime hook).
+ * @code
+ * struct MyPolicy : fccu::DefaultCollectorPolicy {
+ *   using Hooks = fccu::StaticHookTable<&OnOther, fccu::StaticHook<0, &OnOverTemp>,
+ *                                       fccu::StaticHook<1, &OnUnderVolt>>;
+ * };
+ * @endcode
+ */
+template <auto DefaultFn, typename... Hooks>
+struct StaticHookTable {
+  static constexpr bool kStatic = true;
+  static constexpr bool kHasDefault = !std::is_same_v<decltype(DefaultFn), std::nullptr_t>;
+  static_assert(!kHasDefault || std::is_invocable_r_v<HookAction, decltype(DefaultFn), const FaultEvent&>,
+                "StaticHookTable DefaultFn must be nullptr or HookAction(const FaultEvent&)");
+
+  /** @brief Largest bound index + 1 (0 when no StaticHook is given). */
+  static constexpr uint32_t IndexBound() noexcept {
+    uint32_t bound = 0U;
+    ((bound = (Hooks::kIndex + 1U > bound) ? Hooks::kIndex + 1U : bound), ...);
+    return bound;
+  }
+
+  static constexpr bool IndicesUnique() noexcept {
+    constexpr FaultIndex kIdx[] = {Hooks::kIndex..., 0U};
+    for (uint32_t i = 0U; i < sizeof...(Hooks); ++i) {
+      for (uint32_t j = i + 1U; j < sizeof...(Hooks); ++j) {
+        if (kIdx[i] == kIdx[j]) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+  static_assert(IndicesUnique(), "StaticHookTable binds the same fault index twice");
+
+  static HookAction Invoke(const FaultEvent& event) noexcept {
+    HookAction action = HookAction::kHandled;
+    bool bound = ((event.fault_index == Hooks::kIndex && ((action = Hooks::Call(event)), true)) || ...);
+    if constexpr (kHasDefault) {
+      if (!bound) {
+        action = DefaultFn(event);
+      }
+    } else {
+      (void)bound;
+    }
+    return action;
+  }
+};
+
+// ============================================================================
+// Fault Table (Policy::FaultTable)
+// ============================================================================
+
+/** @brief Compile-time description of one fault point (see StaticFaultTable). */
+struct FaultDescriptor {
+  FaultIndex index = 0U;
+  uint32_t fault_code = 0U;
+  uint32_t attr = 0U;
+  uint32_t err_threshold = 1U;
+  FaultPriority priority = FaultPriority::kMedium;  ///< Default for ReportFault<kIdx>()
+  bool bind_hsm = false;                            ///< Attach a PerFaultHsm (threshold = err_threshold)
+};
+
+/** @brief Default Policy::FaultTable: faults are added at runtime with RegisterFault(). */
+struct RuntimeFaultTable {
+  static constexpr bool kStatic = false;
+
+  static constexpr uint32_t IndexBound() noexcept { return 0U; }
+  static constexpr uint32_t HsmCount() noexcept { return 0U; }
+
+  template <uint32_t N>
+  static constexpr std::array<uint64_t, 0> RegisteredBitmap() noexcept {
+    return {};
+  }
+
+  template <uint32_t N>
+  static constexpr std::array<FaultDescriptor, 0> ByIndex() noexcept {
+    return {};
+  }
+};
+
+/**
+ * @brief Policy::FaultTable built from a constexpr descriptor array.
+ *
+ * Duplicate indices and zero thresholds fail to compile, the registration
+ * bitmap and per-fault data are constant tables (ROM), RegisterFault() is
+ * unavailable, and ReportFault<kIdx>() needs no runtime range or
+ * registration check. Per-fault HSMs are bound in the collector's
+ * constructor.
+ * @code
+ * inline constexpr std::array<fccu::FaultDescriptor, 2> kFaults{{
+ *     {0U, 0x1001U, 0U, 1U, fccu::FaultPriority::kCritical, true},
+ *     {1U, 0x1002U},
+ * }};
+ * struct MyPolicy : fccu::DefaultCollectorPolicy {
+ *   using FaultTable = fccu::StaticFaultTable<kFaults>;
+ * };
+ * @endcode
+ *
+ * @tparam Table Reference to a constexpr array of FaultDescriptor with static storage
+ */
+template <const auto& Table>
+struct StaticFaultTable {
+  static constexpr bool kStatic = true;
+  static constexpr uint32_t kSize = static_cast<uint32_t>(std::size(Table));
+
+  static constexpr uint32_t IndexBound() noexcept {
+    uint32_t bound = 0U;
+    for (const FaultDescriptor& d : Table) {
+      bound = (d.index + 1U > bound) ? d.index + 1U : bound;
+    }
+    return bound;
+  }
+
+  static constexpr uint32_t HsmCount() noexcept {
+    uint32_t n = 0U;
+    for (const FaultDescriptor& d : Table) {
+      n += d.bind_hsm ? 1U : 0U;
+    }
+    return n;
+  }
+
+  static constexpr bool Contains(FaultIndex index) noexcept {
+    for (const FaultDescriptor& d : Table) {
+      if (d.index == index) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /** @brief Descriptor of a listed index (precondition: Contains(index)). */
+  static constexpr const FaultDescriptor& Find(FaultIndex index) noexcept {
+    uint32_t i = 0U;
+    while (Table[i].index != index) {
+      ++i;
+    }
+    return Table[i];
+  }
+
+  /** @brief Registration bitmap for a collector of N faults. */
+  template <uint32_t N>
+  static constexpr std::array<uint64_t, (N + 63U) / 64U> RegisteredBitmap() noexcept {
+    std::array<uint64_t, (N + 63U) / 64U> bits{};
+    for (const FaultDescriptor& d : Table) {
+      bits[d.index / 64U] |= 1ULL << (d.index % 64U);
+    }
+    return bits;
+  }
+
+  /** @brief Descriptors indexed by fault index (unlisted indices zeroed). */
+  template <uint32_t N>
+  static constexpr std::array<FaultDescriptor, N> ByIndex() noexcept {
+    std::array<FaultDescriptor, N> out{};
+    for (const FaultDescriptor& d : Table) {
+      out[d.index] = d;
+    }
+    return out;
+  }
+
+ private:
+  static constexpr bool Valid() noexcept {
+    for (uint32_t i = 0U; i < kSize; ++i) {
+      if (Table[i].err_threshold == 0U) {
+        return false;
+      }
+      for (uint32_t j = i + 1U; j < kSize; ++j) {
+        if (Table[i].index == Table[j].index) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  static_assert(kSize >= 1U, "StaticFaultTable needs at least one descriptor");
+  static_assert(Valid(), "StaticFaultTable: duplicate fault index or err_threshold == 0");
+};
+
+// ============================================================================
+// Collector Policy
+// ============================================================================
+
+/**
+ * @brief Default Policy::Notifier: no consumer wakeup, no code on the report path.
+ *
+ * Blocking notifiers (CondVarNotifier, FutexNotifier, EventFdNotifier) live
+ * in fccu_notifier.hpp and enable FaultCollector::WaitAndProcess().
+ */
+struct NullNotifier {
+  static constexpr bool kEnabled = false;
+  static constexpr bool kProcessShared = true;
+
+  void Notify() noexcept {}
+  uint32_t PrepareWait() const noexcept { return 0U; }
+  bool Wait(uint32_t, uint32_t) noexcept { return false; }
+};
+
+/** @brief Default Policy::Aging: strict priority, a lower level waits while any higher one holds entries. */
+struct NoAging {
+  static constexpr bool kEnabled = false;
+  static constexpr uint32_t DeadlineUs(uint32_t /*level*/) noexcept { return 0U; }
+};
+
+/**
+ * @brief Policy::Aging with a queueing deadline per level, in microseconds.
+ *
+ * An entry that has waited longer than its level's deadline is served
+ * before the higher levels, which bounds the queueing delay of every level
+ * with a deadline (0 = never promote that level; level 0 is never below
+ * another). Levels past the list use 0.
+ * @code
+ * struct MyPolicy : fccu::DefaultCollectorPolicy {
+ *   using Aging = fccu::LevelDeadlines<0U, 2000U, 10000U, 50000U>;
+ * };
+ * @endcode
+ */
+template <uint32_t... kDeadlinesUs>
+struct LevelDeadlines {
+  static_assert(sizeof...(kDeadlinesUs) > 0U, "LevelDeadlines needs at least one deadline");
+  static constexpr bool kEnabled = true;
+  static constexpr uint32_t DeadlineUs(uint32_t level) noexcept {
+    constexpr uint32_t kTable[] = {kDeadlinesUs...};
+    return (level < sizeof...(kDeadlinesUs)) ? kTable[level] : 0U;
+  }
+};
+
+/** @brief Default Policy::DeferTimer: RequestRecheck() is ignored, no timer code or storage. */
+struct NoDeferTimer {
+  static constexpr bool kEnabled = false;
+  static constexpr uint32_t kSlots = 1U;
+  static constexpr uint32_t kTickUs = 1U;
+};
+
+/**
+ * @brief Policy::DeferTimer backed by a hashed timer wheel (timer_wheel.hpp).
+ *
+ * ProcessFaults() advances the wheel from Policy::Clock, so re-checks fire
+ * with kTickUs resolution and are driven by the same tick source as the
+ * timestamps (e.g. a TickClock advanced by the scheduler). Delays longer
+ * than Slots * TickUs take further laps at one compare per lap.
+ * @code
+ * struct MyPolicy : fccu::DefaultCollectorPolicy {
+ *   using DeferTimer = fccu::DeferTimerWheel<64U, 1000U>;  // 1 ms ticks
+ * };
+ * @endcode
+ */
+template <uint32_t Slots = 64U, uint32_t TickUs = 1000U>
+struct DeferTimerWheel {
+  static_assert(TickUs >= 1U, "DeferTimerWheel TickUs must be >= 1");
+  static constexpr bool kEnabled = true;
+  static constexpr uint32_t kSlots = Slots;
+  static constexpr uint32_t kTickUs = TickUs;
+};
+
+/**
+ * @brief Default compile-time policy bundle for FaultCollector.
+ *
+ * Override individual members by deriving:
+ * @code
+ * struct MyPolicy : fccu::DefaultCollectorPolicy {
+ *   using Clock = fccu::CycleCounterClock;
+ * };
+ * fccu::FaultCollector<64, 32, 4, 8, 1, MyPolicy> collector;
+ * @endcode
+ *
+ * Clock:              timestamp source stored in FaultEntry (see fccu_clock.hpp).
+ * Entry:              queued entry encoding, FaultEntry (16 bytes) or
+ *                     PackedFaultEntry (8 bytes).
+ * Admission:          per-level admission thresholds, normal and throttled
+ *                     (see DefaultAdmissionPolicy in fault_queue_set.hpp).
+ * kLatencyHistograms: per-level queue latency + hook time histograms,
+ *                     recorded by the consumer; no code or storage when false.
+ * kCoalescing:        per-fault duplicate coalescing storage (enable per
+ *                     fault with SetCoalescing()); nothing when false.
+ * kDeferredOverflow:  opt-in OverflowMode::kDeferred drop counters (4 bytes
+ *                     per fault plus a bit per fault); when false only
+ *                     kImmediate is available and the storage is compiled out.
+ * Notifier:           consumer wakeup for WaitAndProcess(); producers signal
+ *                     on the empty -> non-empty transition and on kCritical.
+ * kWaitSpins:         empty polls WaitAndProcess() spins through before parking.
+ * Hooks:              RuntimeHooks (RegisterHook() table) or a StaticHookTable
+ *                     resolved at compile time.
+ * FaultTable:         RuntimeFaultTable (RegisterFault()) or a StaticFaultTable
+ *                     over a constexpr FaultDescriptor array.
+ * kSnapshots:         consumer-published StateSnapshot readable through
+ *                     Snapshot() from any thread; no code or storage when false.
+ * kCompactHsm:        table-driven CompactGlobalHsm plus a one-byte lifecycle
+ *                     state for every fault (CompactFaultHsmArray) instead of
+ *                     hsm-cpp machines and the MaxPerFaultHsm pool (set it to 0).
+ * Aging:              NoAging (strict priority) or LevelDeadlines<...>, which
+ *                     serves entries past their level's deadline first.
+ * DeferTimer:         NoDeferTimer or DeferTimerWheel<...>, which re-runs
+ *                     hooks that called RequestRecheck() once the delay expires.
+ */
+struct DefaultCollectorPolicy {
+  using Clock = SteadyClock;
+  using Entry = FaultEntry;
+  using Admission = DefaultAdmissionPolicy;
+  static constexpr bool kLatencyHistograms = false;
+  static constexpr bool kCoalescing = false;
+  static constexpr bool kDeferredOverflow = false;
+  using Notifier = NullNotifier;
+  static constexpr uint32_t kWaitSpins = 1000U;
+  using Hooks = RuntimeHooks;
+  using FaultTable = RuntimeFaultTable;
+  static constexpr bool kSnapshots = false;
+  static constexpr bool kCompactHsm = false;
+  using Aging = NoAging;
+  using DeferTimer = NoDeferTimer;
+};
+
 // ============================================================================
 // FaultCollector - Core Template Class
 // ============================================================================
@@ -137,54 +672,165 @@ struct FaultReporter {
 /**
  * @brief Software Fault Collection and Control Unit.
  *
- * @tparam MaxFaults      Maximum fault points (1..256, default: 64)
+ * @tparam MaxFaults      Maximum fault points (1..65535, default: 64)
  * @tparam QueueDepth     SPSC queue capacity per priority level (power of 2, default: 32)
  * @tparam QueueLevels    Number of priority levels (1..8, default: 4)
- * @tparam MaxPerFaultHsm Maximum per-fault HSM instances (default: 8)
+ * @tparam MaxPerFaultHsm Maximum per-fault HSM instances (0..MaxFaults, default: 8)
+ * @tparam MaxProducers   Producer lanes (1..32, default: 1); above 1, lane 0 is reserved for ReportFault()
+ * @tparam Policy         Compile-time policy bundle (default: DefaultCollectorPolicy)
  */
-template <uint32_t MaxFaults = 64U, uint32_t QueueDepth = 32U, uint32_t QueueLevels = 4U, uint32_t MaxPerFaultHsm = 8U>
+template <uint32_t MaxFaults = 64U, uint32_t QueueDepth = 32U, uint32_t QueueLevels = 4U, uint32_t MaxPerFaultHsm = 8U,
+          uint32_t MaxProducers = 1U, typename Policy = DefaultCollectorPolicy>
 class FaultCollector {
-  static_assert(MaxFaults >= 1U && MaxFaults <= 256U, "MaxFaults must be 1..256");
-  static_assert(QueueLevels >= 1U && QueueLevels <= 8U, "QueueLevels must be 1..8");
-  static_assert(MaxPerFaultHsm <= 16U, "MaxPerFaultHsm must be <= 16");
+  static_assert(MaxFaults >= 1U && MaxFaults <= 0xFFFFU, "MaxFaults must be 1..65535");
+  static_assert(QueueLevels >= 1U && QueueLevels <= FaultStatistics::kMaxLevels, "QueueLevels must be 1..8");
+  static_assert(MaxPerFaultHsm <= MaxFaults, "MaxPerFaultHsm must be <= MaxFaults");
+  static_assert(MaxProducers >= 1U && MaxProducers <= 32U, "MaxProducers must be 1..32");
+  static_assert(MaxPerFaultHsm < 0xFFFFU, "HSM slot references are 16-bit");
 
  public:
   static constexpr uint32_t kMaxFaults = MaxFaults;
   static constexpr uint32_t kQueueDepth = QueueDepth;
   static constexpr uint32_t kQueueLevels = QueueLevels;
+  static constexpr uint32_t kMaxProducers = MaxProducers;
+  static constexpr uint32_t kClaimableLanes = (MaxProducers > 1U) ? MaxProducers - 1U : 1U;
   static constexpr uint32_t kRecentRingSize = 16U;
+  static constexpr uint32_t kDrainBlock = 16U;  ///< Max entries popped per ProcessFaults() block
+
+  using PolicyType = Policy;
+  using Clock = typename Policy::Clock;
+  using QueueEntry = typename Policy::Entry;
+  static_assert(MaxFaults <= QueueEntry::kIndexLimit, "MaxFaults exceeds the fault index range of Policy::Entry");
+  using Histogram = LatencyHistogram<>;
+  static constexpr bool kLatencyHistograms = Policy::kLatencyHistograms;
+  static_assert(!kLatencyHistograms || Clock::kEnabled, "Latency histograms need a Clock that timestamps");
+  static constexpr bool kCoalescing = Policy::kCoalescing;
+  static constexpr bool kDeferredOverflow = Policy::kDeferredOverflow;
+  using Notifier = typename Policy::Notifier;
+  using Hooks = typename Policy::Hooks;
+  static_assert(Hooks::IndexBound() <= MaxFaults, "StaticHook index out of range");
+  using FaultTable = typename Policy::FaultTable;
+  static_assert(FaultTable::IndexBound() <= MaxFaults, "FaultDescriptor index out of range");
+  static constexpr bool kCompactHsm = Policy::kCompactHsm;
+  static_assert(!kCompactHsm || MaxPerFaultHsm == 0U,
+                "Policy::kCompactHsm tracks every fault: MaxPerFaultHsm must be 0");
+  static_assert(kCompactHsm || FaultTable::HsmCount() <= MaxPerFaultHsm,
+                "FaultDescriptor bind_hsm count exceeds MaxPerFaultHsm");
+  using GlobalHsmType = std::conditional_t<kCompactHsm, CompactGlobalHsm, GlobalHsm>;
+  using Aging = typename Policy::Aging;
+  static_assert(!Aging::kEnabled || Clock::kEnabled, "Aging needs a Clock that timestamps");
+  using DeferTimer = typename Policy::DeferTimer;
+  static_assert(!DeferTimer::kEnabled || Clock::kEnabled, "DeferTimer needs a Clock that timestamps");
+  static constexpr bool kSnapshots = Policy::kSnapshots;
+  static constexpr uint32_t kBitmapWords = (MaxFaults + 63U) / 64U;
+
+  /**
+   * @brief Consistent copy of the collector state (Policy::kSnapshots).
+   *
+   * Every field is captured in one PublishSnapshot() call on the consumer
+   * thread, so they agree with each other as of that point, unlike separate
+   * GetStatistics() / IsFaultActive() / GetGlobalHsm() / ForEachRecent() calls.
+   */
+  struct StateSnapshot {
+    uint64_t version = 0U;       ///< Publish count, increases by one per PublishSnapshot()
+    uint64_t timestamp_us = 0U;  ///< Steady clock at publish
+    FaultStatistics stats{};     ///< As GetStatistics()
+    std::array<uint64_t, kBitmapWords> active_bitmap{};
+    uint32_t active_count = 0U;
+    GlobalState global_state = GlobalState::kIdle;
+    uint32_t fault_hsm_count = 0U;  ///< Valid entries in fault_hsms (bind order)
+    std::array<FaultHsmSnapshot, MaxPerFaultHsm> fault_hsms{};
+    std::array<FaultState, kCompactHsm ? MaxFaults : 0U> fault_states{};  ///< Policy::kCompactHsm: every fault
+    std::array<uint32_t, QueueLevels> queue_depth{};  ///< Entries queued per level, over all lanes
+    uint32_t recent_count = 0U;                       ///< Valid entries in recent
+    std::array<RecentFaultInfo, kRecentRingSize> recent{};  ///< Newest first
+
+    bool IsFaultActive(FaultIndex fault_index) const noexcept {
+      return fault_index < MaxFaults && (active_bitmap[fault_index / 64U] & (1ULL << (fault_index % 64U))) != 0U;
+    }
+  };
+
+  FaultCollector() noexcept {
+    if constexpr (std::is_same<Clock, CycleCounterClock>::value) {
+      if (!Clock::IsCalibrated()) {
+        (void)Clock::Calibrate();  // Busy-waits once here rather than in the first processed hook
+      }
+    }
+    if constexpr (FaultTable::kStatic && !kCompactHsm) {
+      for (const FaultDescriptor& d : kStaticTable) {
+        if (d.bind_hsm) {
+          (void)BindFaultHsm(d.index, d.err_threshold);
+        }
+      }
+    }
+  }
 
   // --- Configuration (call before processing) ---
 
-  FccuError RegisterFault(uint16_t fault_index, uint32_t fault_code, uint32_t attr = 0U,
+  FccuError RegisterFault(FaultIndex fault_index, uint32_t fault_code, uint32_t attr = 0U,
                           uint32_t err_threshold = 1U) noexcept {
+    static_assert(!FaultTable::kStatic, "Faults are fixed by Policy::FaultTable (StaticFaultTable)");
     if (fault_index >= MaxFaults) {
       return FccuError::kInvalidIndex;
     }
-    auto& entry = table_[fault_index];
-    if (entry.registered) {
+    if (IsRegistered(fault_index)) {
       return FccuError::kAlreadyRegistered;
     }
-    entry.fault_code = fault_code;
-    entry.attr = attr;
-    entry.err_threshold = err_threshold;
-    entry.registered = true;
+    auto& info = fault_info_[fault_index];
+    info.fault_code = fault_code;
+    info.attr = attr;
+    info.err_threshold = err_threshold;
+    registered_bitmap_[fault_index / 64U] |= 1ULL << (fault_index % 64U);
+    return FccuError::kOk;
+  }
+
+  FccuError RegisterHook(FaultIndex fault_index, FaultHookFn fn, void* ctx = nullptr) noexcept {
+    static_assert(!Hooks::kStatic, "Hooks are fixed by Policy::Hooks (StaticHookTable)");
+    if (fault_index >= MaxFaults) {
+      return FccuError::kInvalidIndex;
+    }
+    if (!IsRegistered(fault_index)) {
+      return FccuError::kNotRegistered;
+    }
+    fault_info_[fault_index].hook_fn = fn;
+    fault_info_[fault_index].hook_ctx = ctx;
     return FccuError::kOk;
   }
 
-  FccuError RegisterHook(uint16_t fault_index, FaultHookFn fn, void* ctx = nullptr) noexcept {
+  /**
+   * @brief Coalesce duplicate reports of a fault while one is pending (Policy::kCoalescing).
+   *
+   * While an entry for the fault is queued and not yet processed, further
+   * reports at the same or a lower priority only bump an atomic counter and
+   * overwrite the latest detail; they use no queue slot and skip the HSM.
+   * The consumer delivers a single FaultEvent with coalesced_count set to
+   * the number of reports and detail set to the latest one. A more urgent
+   * report still enqueues and absorbs the pending count, so coalescing
+   * never delays a higher-priority reaction.
+   *
+   * With several producers, reports coalesced onto an entry that is then
+   * refused by admission are lost along with it.
+   */
+  template <bool kEnabled = kCoalescing>
+  FccuError SetCoalescing(FaultIndex fault_index, bool enable = true) noexcept {
+    static_assert(kEnabled, "Enable Policy::kCoalescing");
     if (fault_index >= MaxFaults) {
       return FccuError::kInvalidIndex;
     }
-    if (!table_[fault_index].registered) {
+    if (!IsRegistered(fault_index)) {
       return FccuError::kNotRegistered;
     }
-    table_[fault_index].hook_fn = fn;
-    table_[fault_index].hook_ctx = ctx;
+    uint64_t bit = 1ULL << (fault_index % 64U);
+    if (enable) {
+      coalesce_.enabled[fault_index / 64U] |= bit;
+    } else {
+      coalesce_.enabled[fault_index / 64U] &= ~bit;
+    }
     return FccuError::kOk;
   }
 
   void SetDefaultHook(FaultHookFn fn, void* ctx = nullptr) noexcept {
+    static_assert(!Hooks::kStatic, "Hooks are fixed by Policy::Hooks (StaticHookTable)");
     default_hook_fn_ = fn;
     default_hook_ctx_ = ctx;
   }
@@ -194,107 +840,460 @@ class FaultCollector {
     overflow_ctx_ = ctx;
   }
 
+  /**
+   * @brief Select immediate (producer) or deferred (consumer) overflow signalling (call before reporting).
+   *
+   * Without Policy::kDeferredOverflow, kDeferred is ignored and the mode stays kImmediate.
+   */
+  void SetOverflowMode(OverflowMode mode) noexcept {
+    if (kDeferredOverflow || mode == OverflowMode::kImmediate) {
+      overflow_mode_ = mode;
+    }
+  }
+  OverflowMode GetOverflowMode() const noexcept { return overflow_mode_; }
+
+  /** @brief OverflowMode::kDeferred: called once per fault that dropped reports, with the drop count. */
+  void SetDeferredOverflowCallback(DeferredOverflowFn fn, void* ctx = nullptr) noexcept {
+    deferred_overflow_fn_ = fn;
+    deferred_overflow_ctx_ = ctx;
+  }
+
+  /** @brief OverflowMode::kDeferred: called once per delivery with the aggregate. */
+  void SetOverflowSummaryCallback(OverflowSummaryFn fn, void* ctx = nullptr) noexcept {
+    overflow_summary_fn_ = fn;
+    overflow_summary_ctx_ = ctx;
+  }
+
   void SetShutdownCallback(ShutdownFn fn, void* ctx = nullptr) noexcept {
     shutdown_fn_ = fn;
     shutdown_ctx_ = ctx;
   }
 
-  void SetBusNotifier(BusNotifyFn fn, void* ctx = nullptr) noexcept {
+  /**
+   * @brief Per-event bus notification, plus an optional end-of-batch flush.
+   *
+   * flush_fn (same ctx) runs once at the end of every ProcessFaults() call
+   * that processed at least one entry, so a bridge can stage events and
+   * publish them in one message (see fccu_mccc_bridge.hpp).
+   */
+  void SetBusNotifier(BusNotifyFn fn, void* ctx = nullptr, BusFlushFn flush_fn = nullptr) noexcept {
     bus_notify_fn_ = fn;
     bus_notify_ctx_ = ctx;
+    bus_flush_fn_ = flush_fn;
+  }
+
+  /**
+   * @brief Recorder stage: fn sees every processed FaultEvent, flush_fn ends each batch.
+   *
+   * Same calling points as the bus notifier, kept separate so a black-box
+   * recorder (FaultRecorder in fault_recorder.hpp) and a bus bridge can be
+   * attached together.
+   */
+  void SetRecorder(RecordFn fn, void* ctx = nullptr, RecordFlushFn flush_fn = nullptr) noexcept {
+    record_fn_ = fn;
+    record_ctx_ = ctx;
+    record_flush_fn_ = flush_fn;
+  }
+
+  /**
+   * @brief Uplink stage: fn sees only the events worth forwarding upward.
+   *
+   * Runs on the consumer after the hook verdict, for first occurrences,
+   * threshold confirmations and escalations (kUplink* reasons); flush_fn
+   * runs at the end of every ProcessFaults() that produced any. Used by
+   * FaultAggregator (fccu_hierarchy.hpp) to feed a parent collector.
+   */
+  void SetUplink(UplinkFn fn, void* ctx = nullptr, UplinkFlushFn flush_fn = nullptr) noexcept {
+    uplink_fn_ = fn;
+    uplink_ctx_ = ctx;
+    uplink_flush_fn_ = flush_fn;
+  }
+
+  /**
+   * @brief Select where report-side HSM transitions run (call before reporting).
+   *
+   * Defaults to kOnReport for a single producer and kOnProcess when
+   * MaxProducers > 1, where kOnReport would race between lanes.
+   */
+  void SetHsmDispatchMode(HsmDispatchMode mode) noexcept { hsm_mode_ = mode; }
+  HsmDispatchMode GetHsmDispatchMode() const noexcept { return hsm_mode_; }
+
+  /**
+   * @brief Tie admission throttling to the GlobalHsm Degraded state.
+   *
+   * While enabled and the FCCU is Degraded, producers use the throttled
+   * admission table of Policy::Admission (by default Medium 40%, Low 30%),
+   * keeping queue space for critical traffic. Leaving Degraded lifts it.
+   */
+  void SetDegradedThrottling(bool enable) noexcept {
+    degraded_throttling_.store(enable, std::memory_order_relaxed);
+    SyncAdmissionThrottle();
   }
 
-  FccuError BindFaultHsm(uint16_t fault_index, uint32_t threshold = 1U) noexcept {
+  bool IsDegradedThrottlingEnabled() const noexcept { return degraded_throttling_.load(std::memory_order_relaxed); }
+
+  /** @brief True while producers are subject to the throttled admission table. */
+  bool IsAdmissionThrottled() const noexcept { return queue_set_.IsThrottled(); }
+
+  /**
+   * @brief Attach a lifecycle HSM to a fault (re-binding resets the existing one).
+   */
+  FccuError BindFaultHsm(FaultIndex fault_index, uint32_t threshold = 1U) noexcept {
+    static_assert(!kCompactHsm, "Policy::kCompactHsm tracks every fault; thresholds come from RegisterFault()");
     if (fault_index >= MaxFaults) {
       return FccuError::kInvalidIndex;
     }
+    uint16_t slot_ref = hsm_slot_of_[fault_index];
+    if (slot_ref != 0U) {
+      per_fault_hsms_[slot_ref - 1U].Bind(fault_index, threshold);
+      return FccuError::kOk;
+    }
     if (per_fault_hsm_count_ >= MaxPerFaultHsm) {
       return FccuError::kHsmSlotFull;
     }
     uint32_t slot = per_fault_hsm_count_++;
-    per_fault_hsm_map_[slot] = fault_index;
+    hsm_slot_of_[fault_index] = static_cast<uint16_t>(slot + 1U);
     per_fault_hsms_[slot].Bind(fault_index, threshold);
     return FccuError::kOk;
   }
 
+  // --- Producer lanes ---
+
+  /**
+   * @brief Claim a dedicated queue lane for the calling producer thread.
+   *
+   * Each producer thread that reports concurrently with others must own a
+   * lane and report through ReportFaultFrom() / GetReporter(lane). With
+   * MaxProducers > 1, lane 0 is kept for the lane-less ReportFault() /
+   * ReportFaults() / GetReporter() path, leaving kClaimableLanes to claim.
+   */
+  FccuError RegisterProducer(uint8_t& out_lane) noexcept {
+    if (!queue_set_.RegisterProducer(out_lane)) {
+      return FccuError::kProducerSlotFull;
+    }
+    return FccuError::kOk;
+  }
+
+  /** @brief Return a lane claimed by RegisterProducer(). */
+  void ReleaseProducer(uint8_t lane) noexcept { queue_set_.ReleaseProducer(lane); }
+
   // --- Reporting (producer side, hot path) ---
 
-  FccuError ReportFault(uint16_t fault_index, uint32_t detail = 0U,
+  /** @brief Report a fault through lane 0 (single-producer usage). */
+  FccuError ReportFault(FaultIndex fault_index, uint32_t detail = 0U,
                         FaultPriority priority = FaultPriority::kMedium) noexcept {
-    if (fault_index >= MaxFaults) {
+    return ReportFaultFrom(0U, fault_index, detail, priority);
+  }
+
+  /**
+   * @brief Report a fault through a producer lane.
+   *
+   * The queue push is wait-free per lane. In HsmDispatchMode::kOnProcess the
+   * producer does nothing beyond timestamp, enqueue, active bit and counters.
+   */
+  FccuError ReportFaultFrom(uint8_t lane, FaultIndex fault_index, uint32_t detail = 0U,
+                            FaultPriority priority = FaultPriority::kMedium) noexcept {
+    if (fault_index >= MaxFaults || lane >= MaxProducers) {
       return FccuError::kInvalidIndex;
     }
-    if (!table_[fault_index].registered) {
+    if (!IsRegistered(fault_index)) {
       return FccuError::kNotRegistered;
     }
+    return ReportValidated(lane, fault_index, detail, priority);
+  }
 
-    uint8_t level = static_cast<uint8_t>(priority);
-    if (level >= QueueLevels) {
-      level = static_cast<uint8_t>(QueueLevels - 1U);
+  /**
+   * @brief Report a fault listed in Policy::FaultTable through lane 0.
+   *
+   * The index is checked at compile time; priority defaults to the
+   * descriptor's.
+   */
+  template <FaultIndex kIdx>
+  FccuError ReportFault(uint32_t detail = 0U) noexcept {
+    return ReportFaultFrom<kIdx>(0U, detail, FaultTable::Find(kIdx).priority);
+  }
+
+  template <FaultIndex kIdx>
+  FccuError ReportFault(uint32_t detail, FaultPriority priority) noexcept {
+    return ReportFaultFrom<kIdx>(0U, detail, priority);
+  }
+
+  /** @brief Compile-time-checked ReportFaultFrom(); only the lane is validated. */
+  template <FaultIndex kIdx>
+  FccuError ReportFaultFrom(uint8_t lane, uint32_t detail, FaultPriority priority) noexcept {
+    static_assert(FaultTable::kStatic, "ReportFault<kIdx>() needs a StaticFaultTable policy");
+    static_assert(FaultTable::Contains(kIdx), "Fault index not in Policy::FaultTable");
+    if (lane >= MaxProducers) {
+      return FccuError::kInvalidIndex;
     }
+    return ReportValidated(lane, kIdx, detail, priority);
+  }
 
-    FaultEntry entry{};
-    entry.fault_index = fault_index;
-    entry.priority = priority;
-    entry.detail = detail;
-    entry.timestamp_us = detail::SteadyNowUs();
+  /** @brief Report a batch of faults through lane 0 (single-producer usage). */
+  FaultBatchResult ReportFaults(const FaultReport* reports, uint32_t count, FccuError* out_errors = nullptr) noexcept {
+    return ReportFaultsFrom(0U, reports, count, out_errors);
+  }
 
-    bool pushed = queue_set_.PushWithAdmission(level, entry);
-    if (!pushed) {
-      stats_total_dropped_.fetch_add(1U, std::memory_order_relaxed);
-      if (level < 4U) {
-        stats_dropped_[level].fetch_add(1U, std::memory_order_relaxed);
+  /**
+   * @brief Report a batch of faults through a producer lane.
+   *
+   * Amortizes the per-fault fixed cost: one timestamp for the whole batch,
+   * entries grouped by level and pushed in bulk, statistics and global HSM
+   * updated once per batch. Entries keep their relative order within a level.
+   *
+   * @param lane            Producer lane
+   * @param reports         Array of reports
+   * @param count           Number of reports
+   * @param[out] out_errors Optional per-report result array (count elements)
+   * @return Admitted / dropped / rejected counts
+   */
+  FaultBatchResult ReportFaultsFrom(uint8_t lane, const FaultReport* reports, uint32_t count,
+                                    FccuError* out_errors = nullptr) noexcept {
+    FaultBatchResult result{};
+    if (reports == nullptr || count == 0U) {
+      return result;
+    }
+    if (lane >= MaxProducers) {
+      result.rejected = count;
+      for (uint32_t i = 0U; out_errors != nullptr && i < count; ++i) {
+        out_errors[i] = FccuError::kInvalidIndex;
+      }
+      return result;
+    }
+
+    // Pass 1: validate and collect the set of levels present
+    uint32_t level_mask = 0U;
+    for (uint32_t i = 0U; i < count; ++i) {
+      FccuError err = CheckReportable(reports[i].fault_index);
+      if (err != FccuError::kOk) {
+        ++result.rejected;
+      } else {
+        level_mask |= 1U << LevelOf(reports[i].priority);
       }
-      if (overflow_fn_ != nullptr) {
-        overflow_fn_(fault_index, priority, overflow_ctx_);
+      if (out_errors != nullptr) {
+        out_errors[i] = err;
       }
-      return FccuError::kQueueFull;
     }
 
-    // Set active bit
-    SetFaultActive(fault_index);
+    const uint64_t now = Clock::Now();
+    std::array<uint32_t, QueueLevels> reported{};
+    std::array<uint32_t, QueueLevels> dropped{};
+    bool critical_admitted = false;
 
-    stats_total_reported_.fetch_add(1U, std::memory_order_relaxed);
-    if (level < 4U) {
-      stats_reported_[level].fetch_add(1U, std::memory_order_relaxed);
+    // Pass 2: per level, gather chunks and push them in bulk
+    BatchChunk chunk;
+    for (uint8_t level = 0U; level < static_cast<uint8_t>(QueueLevels); ++level) {
+      if ((level_mask & (1U << level)) == 0U) {
+        continue;
+      }
+      chunk.count = 0U;
+      for (uint32_t i = 0U; i < count; ++i) {
+        const FaultReport& rep = reports[i];
+        if (LevelOf(rep.priority) != level || CheckReportable(rep.fault_index) != FccuError::kOk) {
+          continue;
+        }
+        uint8_t flags = 0U;
+        if constexpr (kCoalescing) {
+          if (IsCoalescing(rep.fault_index)) {
+            CoalesceResult cr = TryCoalesce(rep.fault_index, level, rep.detail);
+            if (cr == CoalesceResult::kCoalesced) {
+              ++result.coalesced;
+              continue;
+            }
+            if (cr == CoalesceResult::kOwner) {
+              flags = kEntryCoalesceOwner;
+            }
+          }
+        }
+        FaultEntry& entry = chunk.entries[chunk.count];
+        entry.fault_index = rep.fault_index;
+        entry.priority = rep.priority;
+        entry.reserved = flags;
+        entry.detail = rep.detail;
+        entry.timestamp = now;
+        chunk.src[chunk.count] = i;
+        chunk.newly_active[chunk.count] = SetFaultActive(rep.fault_index);
+        if (++chunk.count == kBatchChunk) {
+          reported[level] += PushChunk(lane, level, chunk, out_errors, critical_admitted);
+        }
+      }
+      if (chunk.count > 0U) {
+        reported[level] += PushChunk(lane, level, chunk, out_errors, critical_admitted);
+      }
+      dropped[level] = chunk.dropped;
+      chunk.dropped = 0U;
+      result.admitted += reported[level];
+      result.dropped += dropped[level];
     }
 
-    // Notify per-fault HSM
-    DispatchPerFaultEvent(fault_index, evt::kDetected);
-
-    // Update global HSM
-    if (global_hsm_.IsIdle()) {
-      global_hsm_.Dispatch(evt::kFaultReported);
+    // Statistics: once per batch, into this lane's shard
+    ProducerStats& ps = producer_stats_[lane];
+    if (result.admitted > 0U) {
+      AddRelaxed(ps.reported, result.admitted);
     }
-    if (priority == FaultPriority::kCritical && !global_hsm_.IsDegraded()) {
-      global_hsm_.Dispatch(evt::kCriticalDetected);
-      global_hsm_.context().critical_count++;
+    if (result.dropped > 0U) {
+      AddRelaxed(ps.dropped, result.dropped);
+    }
+    if (result.coalesced > 0U) {
+      AddRelaxed(ps.coalesced, result.coalesced);
+    }
+    for (uint32_t level = 0U; level < QueueLevels; ++level) {
+      if (reported[level] > 0U) {
+        AddRelaxed(ps.level_reported[level], reported[level]);
+      }
+      if (dropped[level] > 0U) {
+        AddRelaxed(ps.level_dropped[level], dropped[level]);
+      }
     }
 
-    return FccuError::kOk;
+    if (result.admitted > 0U && hsm_mode_ == HsmDispatchMode::kOnReport) {
+      DispatchGlobalReported(critical_admitted);
+    }
+    if constexpr (Notifier::kEnabled) {
+      if (chunk.was_empty || critical_admitted) {
+        notifier_.Notify();  // Once per batch
+      }
+    }
+    return result;
   }
 
   // --- Processing (consumer side) ---
 
-  uint32_t ProcessFaults() noexcept {
+  /**
+   * @brief Drain queued faults in priority order.
+   *
+   * Deferred overflow drops (OverflowMode::kDeferred) are delivered first.
+   * Entries are then popped in contiguous blocks of up to kDrainBlock from
+   * the highest non-empty level and handled in a tight loop; the level is
+   * re-selected after every block. With Policy::Aging, a block of entries
+   * past their level's deadline is taken first when a lower level has any.
+   * Either budget stops the drain early, leaving the remainder queued for
+   * the next call. With Policy::DeferTimer, the hooks whose RequestRecheck()
+   * delay expired are re-run before the drain (not counted in max_items or the
+   * return value). The recorder and bus flush callbacks run once at the end
+   * if anything was processed, followed by PublishSnapshot() when
+   * Policy::kSnapshots is set (also after re-checks alone).
+   *
+   * @param max_items Maximum entries to process (0 = no limit)
+   * @param max_us    Time budget in microseconds, checked between blocks (0 = no limit).
+   *                  Measured with steady_clock regardless of Policy::Clock, since a
+   *                  tick-cached clock does not advance within one call.
+   * @return Number of entries processed
+   */
+  uint32_t ProcessFaults(uint32_t max_items = 0U, uint32_t max_us = 0U) noexcept {
     if (shutdown_requested_) {
       return 0U;
     }
+    DeliverDeferredOverflow();
+    RepairUndoneActive();
+    uint32_t rechecked = 0U;
+    if constexpr (DeferTimer::kEnabled) {
+      rechecked = RunDueRechecks();
+    }
 
+    const uint64_t deadline = (max_us != 0U) ? detail::SteadyNowUs() + max_us : 0U;
     uint32_t total = 0U;
-    FaultEntry entry{};
+    std::array<QueueEntry, kDrainBlock> block;
     uint8_t level = 0U;
 
-    while (queue_set_.Pop(entry, level)) {
-      ProcessEntry(entry);
-      ++total;
+    for (;;) {
+      uint32_t want = kDrainBlock;
+      if (max_items != 0U) {
+        if (total >= max_items) {
+          break;
+        }
+        if (max_items - total < want) {
+          want = max_items - total;
+        }
+      }
+      uint32_t n = 0U;
+      if constexpr (Aging::kEnabled) {
+        n = PopOverdue(block.data(), want, level);
+      }
+      if (n == 0U) {
+        n = static_cast<uint32_t>(queue_set_.PopBatch(block.data(), want, level));
+      }
+      if (n == 0U) {
+        break;
+      }
+      const uint64_t now = kPackedEntries ? Clock::Now() : 0U;  // Widens packed timestamps
+      for (uint32_t i = 0U; i < n; ++i) {
+        ProcessEntry(block[i].Decode(static_cast<FaultPriority>(level), entry_epoch_, now));
+      }
+      total += n;
+      if (deadline != 0U && detail::SteadyNowUs() >= deadline) {
+        break;
+      }
     }
-    return total;
-  }
-
+    if (total > 0U) {
+      if (record_flush_fn_ != nullptr) {
+        record_flush_fn_(record_ctx_);
+      }
+      if (bus_flush_fn_ != nullptr) {
+        bus_flush_fn_(bus_notify_ctx_);
+      }
+    }
+    if (uplink_flush_fn_ != nullptr && (total > 0U || rechecked > 0U)) {
+      uplink_flush_fn_(uplink_ctx_);
+    }
+    if constexpr (kSnapshots) {
+      if (total > 0U || rechecked > 0U) {
+        PublishSnapshot();
+      }
+    }
+    return total;
+  }
+
+  /**
+   * @brief Blocking consumer loop body: process, or spin briefly, then park.
+   *
+   * Processes whatever is queued; if nothing was, polls the queue for
+   * Policy::kWaitSpins iterations, then parks on the notifier until a
+   * producer signals (empty -> non-empty transition or a kCritical report),
+   * NotifyConsumer() is called, or the timeout expires. Whatever arrived is
+   * processed before returning. Requires an enabled Policy::Notifier.
+   * While RequestRecheck() re-checks are pending, the park is capped at one
+   * Policy::DeferTimer tick so they fire on time.
+   *
+   * @param timeout_us Maximum park time in microseconds (0 = wait for a signal)
+   * @param max_items  Passed to ProcessFaults() (0 = no limit)
+   * @return Number of entries processed (0 on timeout or shutdown)
+   */
+  uint32_t WaitAndProcess(uint32_t timeout_us = 0U, uint32_t max_items = 0U) noexcept {
+    static_assert(Notifier::kEnabled, "WaitAndProcess() needs a Policy::Notifier (see fccu_notifier.hpp)");
+    uint32_t n = ProcessFaults(max_items);
+    if (n > 0U || shutdown_requested_) {
+      return n;
+    }
+    for (uint32_t i = 0U; i < Policy::kWaitSpins; ++i) {
+      if (HasPendingWork()) {
+        return ProcessFaults(max_items);
+      }
+      detail::CpuRelax();
+    }
+    // Re-check after taking the token: a push after this point bumps the
+    // sequence and Wait() returns at once.
+    if constexpr (DeferTimer::kEnabled) {
+      if (defer_.wheel.Pending() != 0U && (timeout_us == 0U || timeout_us > DeferTimer::kTickUs)) {
+        timeout_us = DeferTimer::kTickUs;
+      }
+    }
+    uint32_t token = notifier_.PrepareWait();
+    if (!HasPendingWork()) {
+      (void)notifier_.Wait(token, timeout_us);
+    }
+    return ProcessFaults(max_items);
+  }
+
+  /** @brief Wake a consumer parked in WaitAndProcess() (e.g. to stop its thread). */
+  void NotifyConsumer() noexcept { notifier_.Notify(); }
+
+  /** @brief Notifier instance, e.g. EventFdNotifier::NativeHandle() for an external poll loop. */
+  Notifier& GetNotifier() noexcept { return notifier_; }
+
   // --- Query Operations ---
 
-  bool IsFaultActive(uint16_t fault_index) const noexcept {
+  bool IsFaultActive(FaultIndex fault_index) const noexcept {
     if (fault_index >= MaxFaults) {
       return false;
     }
@@ -303,66 +1302,170 @@ class FaultCollector {
     return (active_bitmap_[word_idx].load(std::memory_order_relaxed) & (1ULL << bit_idx)) != 0U;
   }
 
-  uint32_t ActiveFaultCount() const noexcept {
-    uint32_t count = 0U;
-    for (uint32_t i = 0U; i < kBitmapWords; ++i) {
-      count += detail::PopCount64(active_bitmap_[i].load(std::memory_order_relaxed));
+  /**
+   * @brief Invoke fn(FaultIndex) for every active fault, in index order.
+   *
+   * Walks the summary bitmap, so the cost scales with the number of
+   * non-empty 64-fault words rather than with MaxFaults.
+   */
+  template <typename Fn>
+  void ForEachActive(Fn&& fn) const {
+    for (uint32_t s = 0U; s < kSummaryWords; ++s) {
+      uint64_t summary = active_summary_[s].load(std::memory_order_acquire);
+      for (; summary != 0U; summary &= summary - 1U) {
+        uint32_t word_idx = s * 64U + detail::CountTrailingZeros64(summary);
+        uint64_t word = active_bitmap_[word_idx].load(std::memory_order_relaxed);
+        for (; word != 0U; word &= word - 1U) {
+          fn(static_cast<FaultIndex>(word_idx * 64U + detail::CountTrailingZeros64(word)));
+        }
+      }
     }
-    return count;
   }
 
-  void ClearFault(uint16_t fault_index) noexcept {
+  /** @brief Number of active faults (maintained incrementally, O(1)). */
+  uint32_t ActiveFaultCount() const noexcept { return active_count_.load(std::memory_order_acquire); }
+
+  void ClearFault(FaultIndex fault_index) noexcept {
     if (fault_index >= MaxFaults) {
       return;
     }
     ClearFaultActive(fault_index);
-    table_[fault_index].occurrence_count.store(0U, std::memory_order_relaxed);
+    occurrence_counts_[fault_index].store(0U, std::memory_order_relaxed);
+    SetKeptActive(fault_index, false);
+    if constexpr (DeferTimer::kEnabled) {
+      (void)defer_.wheel.Cancel(fault_index);
+    }
 
     DispatchPerFaultEvent(fault_index, evt::kClearFault);
 
-    if (ActiveFaultCount() == 0U) {
-      global_hsm_.Dispatch(evt::kAllCleared);
+    if (active_count_.load(std::memory_order_acquire) == 0U) {
+      DispatchGlobalCleared();
     }
   }
 
   void ClearAllFaults() noexcept {
-    for (uint32_t i = 0U; i < kBitmapWords; ++i) {
-      active_bitmap_[i].store(0U, std::memory_order_relaxed);
+    for (uint32_t s = 0U; s < kSummaryWords; ++s) {
+      uint64_t summary = active_summary_[s].exchange(0U, std::memory_order_acq_rel);
+      for (; summary != 0U; summary &= summary - 1U) {
+        uint32_t word_idx = s * 64U + detail::CountTrailingZeros64(summary);
+        uint64_t prev = active_bitmap_[word_idx].exchange(0U, std::memory_order_acq_rel);
+        if (prev != 0U) {
+          active_count_.fetch_sub(detail::PopCount64(prev), std::memory_order_acq_rel);
+        }
+      }
     }
     for (uint32_t i = 0U; i < MaxFaults; ++i) {
-      table_[i].occurrence_count.store(0U, std::memory_order_relaxed);
+      occurrence_counts_[i].store(0U, std::memory_order_relaxed);
+    }
+    if constexpr (kRepairActive) {
+      repair_.kept.fill(0U);
+    }
+    if constexpr (kCompactHsm) {
+      compact_hsms_.ResetAll();
+    }
+    if constexpr (DeferTimer::kEnabled) {
+      defer_.wheel.Clear();
     }
     for (uint32_t i = 0U; i < per_fault_hsm_count_; ++i) {
       per_fault_hsms_[i].Reset();
     }
-    global_hsm_.Dispatch(evt::kAllCleared);
+    DispatchGlobalCleared();
   }
 
+  /** @brief Sum all producer shards and the consumer counters (relative to the last reset). */
   FaultStatistics GetStatistics() const noexcept {
-    FaultStatistics stats{};
-    stats.total_reported = stats_total_reported_.load(std::memory_order_relaxed);
-    stats.total_processed = stats_total_processed_.load(std::memory_order_relaxed);
-    stats.total_dropped = stats_total_dropped_.load(std::memory_order_relaxed);
-    for (uint32_t i = 0U; i < 4U; ++i) {
-      stats.priority_reported[i] = stats_reported_[i].load(std::memory_order_relaxed);
-      stats.priority_dropped[i] = stats_dropped_[i].load(std::memory_order_relaxed);
+    FaultStatistics stats = SumStatistics();
+    stats.total_reported -= stats_base_.total_reported;
+    stats.total_processed -= stats_base_.total_processed;
+    stats.total_dropped -= stats_base_.total_dropped;
+    stats.total_coalesced -= stats_base_.total_coalesced;
+    stats.total_escalated -= stats_base_.total_escalated;
+    stats.total_aged -= stats_base_.total_aged;
+    stats.total_rechecked -= stats_base_.total_rechecked;
+    for (uint32_t i = 0U; i < QueueLevels; ++i) {
+      stats.priority_reported[i] -= stats_base_.priority_reported[i];
+      stats.priority_dropped[i] -= stats_base_.priority_dropped[i];
     }
     return stats;
   }
 
-  void ResetStatistics() noexcept {
-    stats_total_reported_.store(0U, std::memory_order_relaxed);
-    stats_total_processed_.store(0U, std::memory_order_relaxed);
-    stats_total_dropped_.store(0U, std::memory_order_relaxed);
-    for (uint32_t i = 0U; i < 4U; ++i) {
-      stats_reported_[i].store(0U, std::memory_order_relaxed);
-      stats_dropped_[i].store(0U, std::memory_order_relaxed);
+  /**
+   * @brief Zero the statistics as seen by GetStatistics().
+   *
+   * Counters are single-writer and never written here; the current sums are
+   * recorded as a baseline instead, so a reset cannot race with reporting.
+   * Call from the same thread as GetStatistics().
+   */
+  void ResetStatistics() noexcept { stats_base_ = SumStatistics(); }
+
+  // --- Latency (Policy::kLatencyHistograms only) ---
+
+  /**
+   * @brief Report-to-process latency in nanoseconds for one queue level.
+   *
+   * Sampled when ProcessEntry() picks the entry up, at the level it was
+   * queued at. Recorded by the consumer, readable from any thread.
+   */
+  template <bool kEnabled = kLatencyHistograms>
+  const Histogram& GetQueueLatency(uint8_t level) const noexcept {
+    static_assert(kEnabled, "Enable Policy::kLatencyHistograms");
+    return latency_.queue[(level < QueueLevels) ? level : (QueueLevels - 1U)];
+  }
+
+  /** @brief Hook (or default hook) execution time in nanoseconds. */
+  template <bool kEnabled = kLatencyHistograms>
+  const Histogram& GetHookLatency() const noexcept {
+    static_assert(kEnabled, "Enable Policy::kLatencyHistograms");
+    return latency_.hook;
+  }
+
+  /** @brief Clear all latency histograms (consumer thread). */
+  void ResetLatencyHistograms() noexcept {
+    if constexpr (kLatencyHistograms) {
+      for (auto& h : latency_.queue) {
+        h.Reset();
+      }
+      latency_.hook.Reset();
     }
   }
 
+  /**
+   * @brief From inside a hook: run it again for the same fault about delay_us later.
+   *
+   * Applies when the hook then leaves the fault active (kDefer, or kEscalate
+   * at kCritical); kHandled and kShutdown drop the request. The re-check is
+   * run by ProcessFaults() with the same event (is_recheck set), without a
+   * new report or a queue slot, and is cancelled by ClearFault() or by a new
+   * report of the fault being processed first. Without Policy::DeferTimer
+   * the request is ignored.
+   * @return kInvalidIndex unless called from the hook running for fault_index
+   */
+  FccuError RequestRecheck(FaultIndex fault_index, uint32_t delay_us) noexcept {
+    if constexpr (DeferTimer::kEnabled) {
+      if (defer_.hook_fault != fault_index) {
+        return FccuError::kInvalidIndex;
+      }
+      defer_.request_us = (delay_us != 0U) ? delay_us : 1U;
+    }
+    return FccuError::kOk;
+  }
+
+  /** @brief Faults waiting for a RequestRecheck() re-check (always 0 without Policy::DeferTimer). */
+  uint32_t PendingRecheckCount() const noexcept {
+    if constexpr (DeferTimer::kEnabled) {
+      return defer_.wheel.Pending();
+    } else {
+      return 0U;
+    }
+  }
+
+  /** @brief Entries currently queued at a level, summed over all lanes (0 for an invalid level). */
+  uint32_t GetQueueSize(uint8_t level) const noexcept { return static_cast<uint32_t>(queue_set_.Size(level)); }
+
+  /** @brief Fill of the whole queue set: entries over all lanes against the capacity of all lanes. */
   BackpressureLevel GetBackpressureLevel() const noexcept {
     auto total = queue_set_.TotalSize();
-    auto cap = static_cast<decltype(total)>(QueueDepth * QueueLevels);
+    auto cap = static_cast<decltype(total)>(QueueDepth * QueueLevels * MaxProducers);
     if (cap == 0U) {
       return BackpressureLevel::kFull;
     }
@@ -379,6 +1482,61 @@ class FaultCollector {
     return BackpressureLevel::kNormal;
   }
 
+  // --- Snapshots (Policy::kSnapshots only) ---
+
+  /**
+   * @brief Publish the current state for Snapshot() readers (consumer thread).
+   *
+   * Called automatically by every ProcessFaults() that processed entries;
+   * call it directly after consumer-side changes made outside of it, e.g.
+   * ClearFault(), or periodically from an idle consumer to refresh the
+   * queue depths. The publish never waits for readers. With snapshots,
+   * ResetStatistics() belongs on the consumer thread too.
+   */
+  template <bool kEnabled = kSnapshots>
+  void PublishSnapshot() noexcept {
+    static_assert(kEnabled, "Enable Policy::kSnapshots");
+    StateSnapshot& s = snapshot_.staging;
+    s.version = snapshot_.lock.Version() + 1U;
+    s.timestamp_us = detail::SteadyNowUs();
+    s.stats = GetStatistics();
+    for (uint32_t i = 0U; i < kBitmapWords; ++i) {
+      s.active_bitmap[i] = active_bitmap_[i].load(std::memory_order_acquire);
+    }
+    s.active_count = active_count_.load(std::memory_order_acquire);
+    s.global_state = global_hsm_.State();
+    if constexpr (kCompactHsm) {
+      for (uint32_t i = 0U; i < MaxFaults; ++i) {
+        s.fault_states[i] = compact_hsms_.State(i);
+      }
+    }
+    s.fault_hsm_count = per_fault_hsm_count_;
+    for (uint32_t i = 0U; i < per_fault_hsm_count_; ++i) {
+      const PerFaultHsm& hsm = per_fault_hsms_[i];
+      s.fault_hsms[i] = FaultHsmSnapshot{hsm.context().fault_index, hsm.State(), hsm.context().occurrence_count};
+    }
+    for (uint8_t level = 0U; level < static_cast<uint8_t>(QueueLevels); ++level) {
+      s.queue_depth[level] = GetQueueSize(level);
+    }
+    s.recent_count = 0U;
+    ForEachRecent([&s](const RecentFaultInfo& info) { s.recent[s.recent_count++] = info; });
+    snapshot_.lock.Store(s);
+  }
+
+  /**
+   * @brief Copy the latest published StateSnapshot (any thread, lock-free).
+   *
+   * Retries up to max_attempts times if a publish overlaps the copy; never
+   * blocks the consumer or other readers.
+   *
+   * @return false if nothing has been published yet or every attempt overlapped a publish
+   */
+  template <bool kEnabled = kSnapshots>
+  bool Snapshot(StateSnapshot& out, uint32_t max_attempts = 8U) const noexcept {
+    static_assert(kEnabled, "Enable Policy::kSnapshots");
+    return snapshot_.lock.Load(out, max_attempts);
+  }
+
   /** @brief Iterate recent faults (newest first). */
   template <typename Fn>
   void ForEachRecent(Fn&& fn, uint32_t max_count = kRecentRingSize) const {
@@ -392,111 +1550,677 @@ class FaultCollector {
   /** @brief Get a FaultReporter that forwards to this collector's ReportFault. */
   FaultReporter GetReporter() noexcept {
     FaultReporter reporter{};
-    reporter.fn = [](uint16_t fi, uint32_t det, FaultPriority pri, void* ctx) {
+    reporter.fn = [](FaultIndex fi, uint32_t det, FaultPriority pri, void* ctx) {
       static_cast<FaultCollector*>(ctx)->ReportFault(fi, det, pri);
     };
     reporter.ctx = this;
     return reporter;
   }
 
+  /** @brief Get a FaultReporter bound to a producer lane. */
+  FaultReporter GetReporter(uint8_t lane) noexcept {
+    FaultReporter reporter{};
+    if (lane >= MaxProducers) {
+      return reporter;
+    }
+    lane_ctx_[lane].owner = this;
+    lane_ctx_[lane].lane = lane;
+    reporter.fn = [](FaultIndex fi, uint32_t det, FaultPriority pri, void* ctx) {
+      auto* lc = static_cast<LaneContext*>(ctx);
+      lc->owner->ReportFaultFrom(lc->lane, fi, det, pri);
+    };
+    reporter.ctx = &lane_ctx_[lane];
+    return reporter;
+  }
+
   // --- HSM access ---
-  const GlobalHsm& GetGlobalHsm() const noexcept { return global_hsm_; }
+  const GlobalHsmType& GetGlobalHsm() const noexcept { return global_hsm_; }
+
+  /** @brief Lifecycle state of a fault (kDormant if it has no bound HSM). */
+  FaultState GetFaultState(FaultIndex fault_index) const noexcept {
+    if constexpr (kCompactHsm) {
+      return compact_hsms_.State(fault_index);
+    } else {
+      const PerFaultHsm* hsm = GetFaultHsm(fault_index);
+      return (hsm != nullptr) ? hsm->State() : FaultState::kDormant;
+    }
+  }
+
+  /** @brief Per-fault HSM bound to a fault, or nullptr if none is bound (always with kCompactHsm). */
+  const PerFaultHsm* GetFaultHsm(FaultIndex fault_index) const noexcept {
+    if (MaxPerFaultHsm == 0U || fault_index >= MaxFaults || hsm_slot_of_[fault_index] == 0U) {
+      return nullptr;
+    }
+    return &per_fault_hsms_[hsm_slot_of_[fault_index] - 1U];
+  }
   bool IsShutdownRequested() const noexcept { return shutdown_requested_; }
 
  private:
+  static constexpr uint32_t kBatchChunk = 32U;
+  static constexpr bool kPackedEntries = !std::is_same<QueueEntry, FaultEntry>::value;
+  static constexpr bool kRepairActive = MaxProducers > 1U;  ///< See UndoFaultActive()
+
+  static uint8_t LevelOf(FaultPriority priority) noexcept {
+    uint8_t level = static_cast<uint8_t>(priority);
+    if (level >= QueueLevels) {
+      level = static_cast<uint8_t>(QueueLevels - 1U);
+    }
+    return level;
+  }
+
+  /** @brief ReportFaultFrom() after validation: index in range and registered, lane valid. */
+  FccuError ReportValidated(uint8_t lane, FaultIndex fault_index, uint32_t detail, FaultPriority priority) noexcept {
+    uint8_t level = LevelOf(priority);
+
+    FaultEntry entry{};
+    if constexpr (kCoalescing) {
+      if (IsCoalescing(fault_index)) {
+        CoalesceResult cr = TryCoalesce(fault_index, level, detail);
+        if (cr == CoalesceResult::kCoalesced) {
+          AddRelaxed(producer_stats_[lane].coalesced, 1U);
+          return FccuError::kOk;
+        }
+        if (cr == CoalesceResult::kOwner) {
+          entry.reserved = kEntryCoalesceOwner;
+        }
+      }
+    }
+    entry.fault_index = fault_index;
+    entry.priority = priority;
+    entry.detail = detail;
+    entry.timestamp = Clock::Now();
+
+    // Mark active before publishing, so the consumer can never clear the bit
+    // ahead of this set; undone below if the entry is not admitted (see
+    // UndoFaultActive() for lanes sharing the bit).
+    bool newly_active = SetFaultActive(fault_index);
+
+    bool was_empty = false;
+    bool pushed = queue_set_.PushWithAdmission(lane, level, QueueEntry::Encode(entry, entry_epoch_), &was_empty);
+    if (!pushed) {
+      if (newly_active) {
+        UndoFaultActive(fault_index);
+      }
+      ReleaseCoalesceOwner(entry);
+      ProducerStats& ps = producer_stats_[lane];
+      AddRelaxed(ps.dropped, 1U);
+      AddRelaxed(ps.level_dropped[level], 1U);
+      SignalOverflow(fault_index, priority);
+      return FccuError::kQueueFull;
+    }
+
+    ProducerStats& ps = producer_stats_[lane];
+    AddRelaxed(ps.reported, 1U);
+    AddRelaxed(ps.level_reported[level], 1U);
+
+    if (hsm_mode_ == HsmDispatchMode::kOnReport) {
+      DispatchPerFaultEvent(fault_index, evt::kDetected);
+      DispatchGlobalReported(priority == FaultPriority::kCritical);
+    }
+    if constexpr (Notifier::kEnabled) {
+      if (was_empty || priority == FaultPriority::kCritical) {
+        notifier_.Notify();
+      }
+    }
+
+    return FccuError::kOk;
+  }
+
+  FccuError CheckReportable(FaultIndex fault_index) const noexcept {
+    if (fault_index >= MaxFaults) {
+      return FccuError::kInvalidIndex;
+    }
+    if (!IsRegistered(fault_index)) {
+      return FccuError::kNotRegistered;
+    }
+    return FccuError::kOk;
+  }
+
+  struct BatchChunk {
+    std::array<FaultEntry, kBatchChunk> entries;
+    std::array<uint32_t, kBatchChunk> src;  ///< Index into the caller's report array
+    std::array<bool, kBatchChunk> newly_active;
+    uint32_t count = 0U;
+    uint32_t dropped = 0U;
+    bool was_empty = false;  ///< Some push turned the queue set non-empty
+  };
+
+  /** @brief Bulk-push a gathered chunk; drops the tail that was not admitted. Resets chunk.count. */
+  uint32_t PushChunk(uint8_t lane, uint8_t level, BatchChunk& chunk, FccuError* out_errors,
+                     bool& critical_admitted) noexcept {
+    const QueueEntry* items = nullptr;
+    std::array<QueueEntry, kPackedEntries ? kBatchChunk : 0U> encoded;
+    if constexpr (kPackedEntries) {
+      for (uint32_t k = 0U; k < chunk.count; ++k) {
+        encoded[k] = QueueEntry::Encode(chunk.entries[k], entry_epoch_);
+      }
+      items = encoded.data();
+    } else {
+      items = chunk.entries.data();
+    }
+    uint32_t pushed =
+        static_cast<uint32_t>(queue_set_.PushBatchWithAdmission(lane, level, items, chunk.count, &chunk.was_empty));
+    for (uint32_t k = 0U; k < pushed; ++k) {
+      const FaultEntry& entry = chunk.entries[k];
+      if (hsm_mode_ == HsmDispatchMode::kOnReport) {
+        DispatchPerFaultEvent(entry.fault_index, evt::kDetected);
+      }
+      critical_admitted = critical_admitted || (entry.priority == FaultPriority::kCritical);
+    }
+    for (uint32_t k = pushed; k < chunk.count; ++k) {
+      const FaultEntry& entry = chunk.entries[k];
+      // Drops are a suffix, so an entry that first set the bit has no admitted duplicate here
+      if (chunk.newly_active[k]) {
+        UndoFaultActive(entry.fault_index);
+      }
+      ReleaseCoalesceOwner(entry);
+      if (out_errors != nullptr) {
+        out_errors[chunk.src[k]] = FccuError::kQueueFull;
+      }
+      SignalOverflow(entry.fault_index, entry.priority);
+    }
+    chunk.dropped += chunk.count - pushed;
+    chunk.count = 0U;
+    return pushed;
+  }
+
+  // --- Coalescing (Policy::kCoalescing) ---
+  //
+  // pending[idx] packs the queue level of the owning entry (bits 24..31) and
+  // the number of reports it represents (bits 0..23); 0 = nothing pending.
+  // The producer that moves it off 0 enqueues the owner entry; the consumer
+  // takes the count with one exchange when it processes that entry.
+
+  static constexpr uint32_t kPendingCountMask = 0x00FFFFFFU;
+  static constexpr uint32_t kPendingLevelShift = 24U;
+
+  enum class CoalesceResult : uint8_t { kCoalesced, kOwner, kSeparate };
+
+  bool IsCoalescing(FaultIndex fault_index) const noexcept {
+    if constexpr (kCoalescing) {
+      return (coalesce_.enabled[fault_index / 64U] & (1ULL << (fault_index % 64U))) != 0U;
+    } else {
+      return false;
+    }
+  }
+
+  CoalesceResult TryCoalesce(FaultIndex fault_index, uint8_t level, uint32_t detail) noexcept {
+    auto& pending = coalesce_.pending[fault_index];
+    uint32_t cur = pending.load(std::memory_order_acquire);
+    for (;;) {
+      if (cur == 0U) {
+        uint32_t owned = (static_cast<uint32_t>(level) << kPendingLevelShift) | 1U;
+        if (pending.compare_exchange_weak(cur, owned, std::memory_order_acq_rel, std::memory_order_acquire)) {
+          return CoalesceResult::kOwner;
+        }
+        continue;
+      }
+      if ((cur >> kPendingLevelShift) > level || (cur & kPendingCountMask) == kPendingCountMask) {
+        return CoalesceResult::kSeparate;  // Pending entry is less urgent, or the counter is saturated
+      }
+      // Published by the CAS below (release); a lost race just rewrites it
+      coalesce_.latest_detail[fault_index].store(detail, std::memory_order_relaxed);
+      if (pending.compare_exchange_weak(cur, cur + 1U, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return CoalesceResult::kCoalesced;
+      }
+    }
+  }
+
+  /** @brief An owner entry was refused: nothing is pending for the fault any more. */
+  void ReleaseCoalesceOwner(const FaultEntry& entry) noexcept {
+    if constexpr (kCoalescing) {
+      if ((entry.reserved & kEntryCoalesceOwner) != 0U) {
+        coalesce_.pending[entry.fault_index].store(0U, std::memory_order_release);
+      }
+    }
+  }
+
+  /**
+   * @brief Consumer: collect the reports folded into this entry.
+   * @return false if an earlier, more urgent entry already took them
+   */
+  bool TakeCoalesced(const FaultEntry& entry, uint32_t& reports, uint32_t& detail) noexcept {
+    if (!IsCoalescing(entry.fault_index)) {
+      return true;
+    }
+    uint32_t n = coalesce_.pending[entry.fault_index].exchange(0U, std::memory_order_acq_rel) & kPendingCountMask;
+    if ((entry.reserved & kEntryCoalesceOwner) == 0U) {
+      reports = 1U + n;  // Urgent entry absorbs whatever is pending
+      return true;
+    }
+    if (n == 0U) {
+      return false;
+    }
+    reports = n;
+    if (n > 1U) {
+      detail = coalesce_.latest_detail[entry.fault_index].load(std::memory_order_relaxed);
+    }
+    return true;
+  }
+
+  /** @brief Consumer: queued entries or deferred drops are waiting. */
+  bool HasPendingWork() const noexcept {
+    return queue_set_.NonEmptyMask() != 0U || DropsPending() || UndoPending();
+  }
+
+  bool DropsPending() const noexcept {
+    if constexpr (kDeferredOverflow) {
+      return drops_.pending.load(std::memory_order_acquire);
+    } else {
+      return false;
+    }
+  }
+
+  // --- Overflow signalling ---
+
+  void SignalOverflow(FaultIndex fault_index, FaultPriority priority) noexcept {
+    if constexpr (kDeferredOverflow) {
+      if (overflow_mode_ == OverflowMode::kDeferred) {
+        // Only the first drop since the last delivery touches the bitmap
+        if (drops_.counts[fault_index].fetch_add(1U, std::memory_order_acq_rel) == 0U) {
+          drops_.bitmap[fault_index / 64U].fetch_or(1ULL << (fault_index % 64U), std::memory_order_release);
+          drops_.pending.store(true, std::memory_order_release);
+        }
+        return;
+      }
+    }
+    if (overflow_fn_ != nullptr) {
+      overflow_fn_(fault_index, priority, overflow_ctx_);
+    }
+  }
+
+  /**
+   * @brief Consumer: hand out drops recorded since the last call.
+   *
+   * A bit is cleared before its counter is taken, and a producer sets the
+   * bit only after moving the counter off zero, so every drop is either
+   * taken now or leaves both the bit and the pending flag set for next time.
+   */
+  void DeliverDeferredOverflow() noexcept {
+    if constexpr (kDeferredOverflow) {
+      std::atomic<bool>& pending = drops_.pending;
+      if (!pending.load(std::memory_order_relaxed) || !pending.exchange(false, std::memory_order_acq_rel)) {
+        return;
+      }
+      OverflowSummary summary{};
+      for (uint32_t w = 0U; w < kBitmapWords; ++w) {
+        if (drops_.bitmap[w].load(std::memory_order_relaxed) == 0U) {
+          continue;
+        }
+        uint64_t word = drops_.bitmap[w].exchange(0U, std::memory_order_acq_rel);
+        for (; word != 0U; word &= word - 1U) {
+          auto idx = static_cast<FaultIndex>(w * 64U + detail::CountTrailingZeros64(word));
+          uint32_t n = drops_.counts[idx].exchange(0U, std::memory_order_acq_rel);
+          if (n == 0U) {
+            continue;  // Already taken together with an earlier bit
+          }
+          ++summary.fault_count;
+          summary.drop_count += n;
+          if (deferred_overflow_fn_ != nullptr) {
+            deferred_overflow_fn_(idx, n, deferred_overflow_ctx_);
+          }
+        }
+      }
+      if (summary.drop_count > 0U && overflow_summary_fn_ != nullptr) {
+        overflow_summary_fn_(summary, overflow_summary_ctx_);
+      }
+    }
+  }
+
+  void DispatchGlobalReported(bool critical) noexcept {
+    if (global_hsm_.IsIdle()) {
+      global_hsm_.Dispatch(evt::kFaultReported);
+    }
+    if (critical && !global_hsm_.IsDegraded()) {
+      global_hsm_.Dispatch(evt::kCriticalDetected);
+      global_hsm_.context().critical_count++;
+      SyncAdmissionThrottle();
+    }
+  }
+
+  /** @brief No fault left active: Degraded recovers first, then back to Idle. */
+  void DispatchGlobalCleared() noexcept {
+    if (global_hsm_.IsDegraded()) {
+      global_hsm_.Dispatch(evt::kDegradeRecovered);
+    }
+    global_hsm_.Dispatch(evt::kAllCleared);
+    SyncAdmissionThrottle();
+  }
+
+  void SyncAdmissionThrottle() noexcept {
+    queue_set_.SetThrottled(degraded_throttling_.load(std::memory_order_relaxed) && global_hsm_.IsDegraded());
+  }
+
   // --- Bitmap operations (newosp pattern) ---
 
-  void SetFaultActive(uint16_t fault_index) noexcept {
+  //
+  // Two-level layout: active_bitmap_ holds one bit per fault, active_summary_
+  // one bit per non-empty leaf word. The summary is only a search hint; the
+  // leaf word is always authoritative.
+
+  /** @brief Set the active bit; returns true if it flipped (and the count was bumped). */
+  bool SetFaultActive(FaultIndex fault_index) noexcept {
     uint32_t word_idx = fault_index / 64U;
-    uint32_t bit_idx = fault_index % 64U;
-    active_bitmap_[word_idx].fetch_or(1ULL << bit_idx, std::memory_order_relaxed);
+    uint64_t bit = 1ULL << (fault_index % 64U);
+    uint64_t prev = active_bitmap_[word_idx].fetch_or(bit, std::memory_order_acq_rel);
+    if ((prev & bit) != 0U) {
+      return false;
+    }
+    if (prev == 0U) {
+      active_summary_[word_idx / 64U].fetch_or(1ULL << (word_idx % 64U), std::memory_order_acq_rel);
+    }
+    active_count_.fetch_add(1U, std::memory_order_release);
+    return true;
   }
 
-  void ClearFaultActive(uint16_t fault_index) noexcept {
+  /** @brief Clear the active bit; returns true if it flipped (and the count was dropped). */
+  bool ClearFaultActive(FaultIndex fault_index) noexcept {
     uint32_t word_idx = fault_index / 64U;
-    uint32_t bit_idx = fault_index % 64U;
-    active_bitmap_[word_idx].fetch_and(~(1ULL << bit_idx), std::memory_order_relaxed);
+    uint64_t bit = 1ULL << (fault_index % 64U);
+    uint64_t prev = active_bitmap_[word_idx].fetch_and(~bit, std::memory_order_acq_rel);
+    if ((prev & bit) == 0U) {
+      return false;
+    }
+    if (prev == bit) {
+      // Leaf word became empty: drop its summary bit, then restore it if a
+      // concurrent SetFaultActive refilled the word in between.
+      uint64_t sbit = 1ULL << (word_idx % 64U);
+      active_summary_[word_idx / 64U].fetch_and(~sbit, std::memory_order_acq_rel);
+      if (active_bitmap_[word_idx].load(std::memory_order_acquire) != 0U) {
+        active_summary_[word_idx / 64U].fetch_or(sbit, std::memory_order_acq_rel);
+      }
+    }
+    active_count_.fetch_sub(1U, std::memory_order_acq_rel);
+    return true;
+  }
+  // --- Active bit repair (MaxProducers > 1 only) ---
+  //
+  // A producer whose push is refused undoes the active bit it set. With
+  // several lanes that bit may be shared: another lane's entry can have been
+  // admitted, or even processed and kept active (kDefer), in between. The
+  // consumer therefore re-asserts the bit before every hook, remembers which
+  // faults a verdict keeps active, and re-sets those after an undo.
+
+  /** @brief Producer: undo a refused entry's bit and let the consumer repair a fault it keeps active. */
+  void UndoFaultActive(FaultIndex fault_index) noexcept {
+    ClearFaultActive(fault_index);
+    if constexpr (kRepairActive) {
+      repair_.undone[fault_index / 64U].fetch_or(1ULL << (fault_index % 64U), std::memory_order_release);
+      repair_.pending.store(true, std::memory_order_release);
+    }
+  }
+
+  bool UndoPending() const noexcept {
+    if constexpr (kRepairActive) {
+      return repair_.pending.load(std::memory_order_acquire);
+    } else {
+      return false;
+    }
+  }
+
+  /** @brief Consumer: re-set the bits undone since the last call for faults kept active by a verdict. */
+  void RepairUndoneActive() noexcept {
+    if constexpr (kRepairActive) {
+      if (!repair_.pending.load(std::memory_order_relaxed) ||
+          !repair_.pending.exchange(false, std::memory_order_acq_rel)) {
+        return;
+      }
+      for (uint32_t w = 0U; w < kBitmapWords; ++w) {
+        if (repair_.undone[w].load(std::memory_order_relaxed) == 0U) {
+          continue;
+        }
+        uint64_t word = repair_.undone[w].exchange(0U, std::memory_order_acq_rel) & repair_.kept[w];
+        for (; word != 0U; word &= word - 1U) {
+          (void)SetFaultActive(static_cast<FaultIndex>(w * 64U + detail::CountTrailingZeros64(word)));
+        }
+      }
+    }
+  }
+
+  /** @brief Consumer: the fault has an entry or a verdict keeping it active; make sure the bit says so. */
+  void ReassertActive(FaultIndex fault_index) noexcept {
+    if constexpr (kRepairActive) {
+      if (!IsFaultActive(fault_index)) {
+        (void)SetFaultActive(fault_index);
+      }
+    }
+  }
+
+  void SetKeptActive(FaultIndex fault_index, bool kept) noexcept {
+    if constexpr (kRepairActive) {
+      const uint64_t bit = 1ULL << (fault_index % 64U);
+      uint64_t& word = repair_.kept[fault_index / 64U];
+      word = kept ? (word | bit) : (word & ~bit);
+    }
+  }
+
+  bool IsKeptActive(FaultIndex fault_index) const noexcept {
+    if constexpr (kRepairActive) {
+      return (repair_.kept[fault_index / 64U] & (1ULL << (fault_index % 64U))) != 0U;
+    } else {
+      return false;
+    }
   }
 
+
   // --- Entry processing ---
 
   void ProcessEntry(const FaultEntry& entry) noexcept {
-    uint16_t idx = entry.fault_index;
+    FaultIndex idx = entry.fault_index;
     if (idx >= MaxFaults) {
       return;
     }
 
-    auto& tbl = table_[idx];
-    uint32_t prev_count = tbl.occurrence_count.fetch_add(1U, std::memory_order_relaxed);
+    uint32_t reports = 1U;
+    uint32_t detail = entry.detail;
+    if constexpr (kCoalescing) {
+      if (!TakeCoalesced(entry, reports, detail)) {
+        return;  // Already delivered by a more urgent entry of the same fault
+      }
+    }
+
+    // Report-side transitions, deferred to the consumer
+    if (hsm_mode_ == HsmDispatchMode::kOnProcess) {
+      DispatchPerFaultEvent(idx, evt::kDetected);
+      DispatchGlobalReported(entry.priority == FaultPriority::kCritical);
+    }
+
+    if constexpr (kLatencyHistograms) {
+      latency_.queue[LevelOf(entry.priority)].Record(ElapsedNs(entry.timestamp, Clock::Now()));
+    }
+
+    uint32_t prev_count = occurrence_counts_[idx].fetch_add(reports, std::memory_order_relaxed);
 
     FaultEvent evt_data{};
     evt_data.fault_index = idx;
     evt_data.priority = entry.priority;
-    evt_data.fault_code = tbl.fault_code;
-    evt_data.detail = entry.detail;
-    evt_data.timestamp_us = entry.timestamp_us;
-    evt_data.occurrence_count = prev_count + 1U;
+    evt_data.fault_code = FaultCodeOf(idx);
+    evt_data.detail = detail;
+    evt_data.timestamp_us = Clock::ToUs(entry.timestamp);
+    evt_data.occurrence_count = prev_count + reports;
+    evt_data.coalesced_count = reports;
     evt_data.is_first = (prev_count == 0U);
 
     // Record in recent ring
     AddToRecentRing(evt_data);
 
-    // Bus notification
+    // Recorder and bus notification
+    if (record_fn_ != nullptr) {
+      record_fn_(evt_data, record_ctx_);
+    }
     if (bus_notify_fn_ != nullptr) {
       bus_notify_fn_(evt_data, bus_notify_ctx_);
     }
 
     // Per-fault HSM: check threshold for confirmation
-    if (evt_data.occurrence_count >= tbl.err_threshold) {
+    uint8_t uplink = evt_data.is_first ? kUplinkFirst : 0U;
+    const uint32_t threshold = ThresholdOf(idx);
+    if (evt_data.occurrence_count >= threshold) {
       DispatchPerFaultEvent(idx, evt::kConfirmed);
+      if (prev_count < threshold) {
+        uplink |= kUplinkConfirmed;
+      }
     }
 
-    // Invoke hook
-    HookAction action = HookAction::kHandled;
-    if (tbl.hook_fn != nullptr) {
-      action = tbl.hook_fn(evt_data, tbl.hook_ctx);
-    } else if (default_hook_fn_ != nullptr) {
-      action = default_hook_fn_(evt_data, default_hook_ctx_);
+    ReassertActive(idx);
+    RunHook(evt_data, entry.timestamp, uplink);
+    AddRelaxed(consumer_stats_.processed, 1U);
+  }
+
+  /**
+   * @brief Invoke the hook and apply its verdict.
+   *
+   * kEscalate re-runs it at once one level up, original timestamp kept.
+   * timestamp is the raw report time kept for a RequestRecheck() re-run;
+   * uplink holds the kUplink* reasons found so far.
+   */
+  void RunHook(FaultEvent& evt_data, uint64_t timestamp, uint8_t uplink) noexcept {
+    const FaultIndex idx = evt_data.fault_index;
+    const FaultPriority reported = evt_data.priority;
+    if constexpr (DeferTimer::kEnabled) {
+      (void)defer_.wheel.Cancel(idx);  // This run supersedes a pending re-check
+      defer_.hook_fault = idx;
+      defer_.request_us = 0U;
+    }
+    HookAction action = InvokeHook(evt_data);
+    while (action == HookAction::kEscalate && evt_data.priority != FaultPriority::kCritical) {
+      evt_data.priority = static_cast<FaultPriority>(static_cast<uint8_t>(evt_data.priority) - 1U);
+      AddRelaxed(consumer_stats_.escalated, 1U);
+      if (evt_data.priority == FaultPriority::kCritical) {
+        DispatchGlobalReported(true);
+      }
+      action = InvokeHook(evt_data);
+    }
+    if constexpr (DeferTimer::kEnabled) {
+      const uint32_t recheck_us = defer_.request_us;
+      defer_.hook_fault = kNoHookFault;
+      if (recheck_us != 0U && (action == HookAction::kDefer || action == HookAction::kEscalate)) {
+        ArmRecheck(evt_data, timestamp, recheck_us);
+      }
+    }
+    if (uplink_fn_ != nullptr) {
+      uplink |= (evt_data.priority != reported) ? kUplinkEscalated : 0U;
+      if (uplink != 0U) {
+        uplink_fn_(evt_data, uplink, uplink_ctx_);
+      }
     }
 
-    // Handle action
+    if (action != HookAction::kHandled) {
+      SetKeptActive(idx, true);
+    }
     switch (action) {
       case HookAction::kHandled:
+        SetKeptActive(idx, false);
         ClearFaultActive(idx);
         DispatchPerFaultEvent(idx, evt::kClearFault);
-        if (ActiveFaultCount() == 0U) {
-          global_hsm_.Dispatch(evt::kAllCleared);
+        if (active_count_.load(std::memory_order_acquire) == 0U) {
+          DispatchGlobalCleared();
         }
         break;
-      case HookAction::kEscalate:
-        HandleEscalation(entry);
+      case HookAction::kEscalate:  // Already kCritical: stays active, as kDefer
         break;
       case HookAction::kDefer:
         break;
       case HookAction::kShutdown:
         shutdown_requested_ = true;
         global_hsm_.Dispatch(evt::kShutdownReq);
+        SyncAdmissionThrottle();
         if (shutdown_fn_ != nullptr) {
           shutdown_fn_(shutdown_ctx_);
         }
         break;
     }
+  }
+
+  // --- RequestRecheck() re-runs (Policy::DeferTimer only) ---
+
+  static uint64_t DeferTickNow() noexcept { return Clock::ToUs(Clock::Now()) / DeferTimer::kTickUs; }
+
+  void ArmRecheck(const FaultEvent& evt_data, uint64_t timestamp, uint32_t delay_us) noexcept {
+    FaultEntry& e = defer_.entry[evt_data.fault_index];
+    e.fault_index = evt_data.fault_index;
+    e.priority = evt_data.priority;
+    e.detail = evt_data.detail;
+    e.timestamp = timestamp;
+    const uint64_t ticks = (static_cast<uint64_t>(delay_us) + DeferTimer::kTickUs - 1U) / DeferTimer::kTickUs;
+    defer_.wheel.Schedule(evt_data.fault_index, DeferTickNow() + ticks);
+  }
+
+  /** @brief Re-run the hooks whose delay expired, with the event they deferred. */
+  uint32_t RunDueRechecks() noexcept {
+    if (defer_.wheel.Pending() == 0U) {
+      return 0U;
+    }
+    return defer_.wheel.Advance(DeferTickNow(), [this](uint16_t idx) noexcept {
+      if (shutdown_requested_ || !(IsFaultActive(idx) || IsKeptActive(idx))) {
+        return;
+      }
+      ReassertActive(idx);
+      const FaultEntry e = defer_.entry[idx];
+      FaultEvent evt_data{};
+      evt_data.fault_index = idx;
+      evt_data.priority = e.priority;
+      evt_data.fault_code = FaultCodeOf(idx);
+      evt_data.detail = e.detail;
+      evt_data.timestamp_us = Clock::ToUs(e.timestamp);
+      evt_data.occurrence_count = occurrence_counts_[idx].load(std::memory_order_relaxed);
+      evt_data.coalesced_count = 0U;
+      evt_data.is_recheck = true;
+      AddRelaxed(consumer_stats_.rechecked, 1U);
+      RunHook(evt_data, e.timestamp, 0U);
+    });
+  }
 
-    stats_total_processed_.fetch_add(1U, std::memory_order_relaxed);
+  HookAction InvokeHook(const FaultEvent& evt_data) noexcept {
+    if constexpr (Hooks::kStatic) {
+      return TimedHook([&evt_data]() noexcept { return Hooks::Invoke(evt_data); });
+    } else {
+      const FaultInfo& info = fault_info_[evt_data.fault_index];
+      FaultHookFn hook_fn = info.hook_fn;
+      void* hook_ctx = info.hook_ctx;
+      if (hook_fn == nullptr) {
+        hook_fn = default_hook_fn_;
+        hook_ctx = default_hook_ctx_;
+      }
+      if (hook_fn == nullptr) {
+        return HookAction::kHandled;
+      }
+      return TimedHook([&evt_data, hook_fn, hook_ctx]() noexcept { return hook_fn(evt_data, hook_ctx); });
+    }
   }
 
-  void HandleEscalation(const FaultEntry& original) noexcept {
-    uint8_t pri = static_cast<uint8_t>(original.priority);
-    if (pri == 0U) {
-      return;  // Already critical
+  /** @brief Policy::Aging: pop a block of entries past their level's deadline, if a lower level has any. */
+  uint32_t PopOverdue(QueueEntry* out, uint32_t max_count, uint8_t& out_level) noexcept {
+    const uint64_t now = Clock::Now();
+    const uint64_t epoch = entry_epoch_;
+    auto n = queue_set_.PopOverdueBatch(out, max_count, out_level, [now, epoch](const QueueEntry& e, uint8_t level) {
+      return kAgingDeadlineNs[level] != 0U && ElapsedNs(e.Timestamp(epoch, now), now) >= kAgingDeadlineNs[level];
+    });
+    if (n > 0U) {
+      AddRelaxed(consumer_stats_.aged, n);
     }
+    return static_cast<uint32_t>(n);
+  }
 
-    FaultEntry escalated = original;
-    escalated.priority = static_cast<FaultPriority>(pri - 1U);
-    escalated.timestamp_us = detail::SteadyNowUs();
+  static constexpr std::array<uint64_t, QueueLevels> MakeAgingDeadlines() noexcept {
+    std::array<uint64_t, QueueLevels> ns{};
+    for (uint32_t level = 0U; level < QueueLevels; ++level) {
+      ns[level] = static_cast<uint64_t>(Aging::DeadlineUs(level)) * 1000U;
+    }
+    return ns;
+  }
+  static constexpr std::array<uint64_t, QueueLevels> kAgingDeadlineNs = MakeAgingDeadlines();
 
-    if (!queue_set_.Push(static_cast<uint8_t>(pri - 1U), escalated)) {
-      stats_total_dropped_.fetch_add(1U, std::memory_order_relaxed);
+  /** @brief Run a hook, recording its duration when latency histograms are enabled. */
+  template <typename Fn>
+  HookAction TimedHook(Fn&& fn) noexcept {
+    if constexpr (kLatencyHistograms) {
+      const uint64_t start = Clock::Now();
+      HookAction action = fn();
+      latency_.hook.Record(ElapsedNs(start, Clock::Now()));
+      return action;
+    } else {
+      return fn();
     }
   }
 
@@ -512,58 +2236,215 @@ class FaultCollector {
     }
   }
 
-  void DispatchPerFaultEvent(uint16_t fault_index, uint32_t event_id) noexcept {
-    for (uint32_t i = 0U; i < per_fault_hsm_count_; ++i) {
-      if (per_fault_hsm_map_[i] == fault_index) {
-        per_fault_hsms_[i].Dispatch(event_id);
-        return;
-      }
+  void DispatchPerFaultEvent(FaultIndex fault_index, uint32_t event_id) noexcept {
+    if constexpr (kCompactHsm) {
+      const uint32_t count = occurrence_counts_[fault_index].load(std::memory_order_relaxed);
+      (void)compact_hsms_.Dispatch(fault_index, event_id, count, ThresholdOf(fault_index));
+      return;
+    }
+    if (MaxPerFaultHsm == 0U) {
+      return;
+    }
+    uint16_t slot_ref = hsm_slot_of_[fault_index];
+    if (slot_ref != 0U) {
+      per_fault_hsms_[slot_ref - 1U].Dispatch(event_id);
     }
   }
 
-  // --- Fault table ---
-  struct FaultTableEntry {
+  // --- Fault table (structure of arrays) ---
+  //
+  // Split by access pattern: the producer only tests registered_bitmap_
+  // (one bit per fault), the consumer bumps occurrence_counts_ (dense, 4 bytes
+  // per fault) and reads the registration-time FaultInfo of the entry it is
+  // processing. A storm over many indices touches a few bitmap words instead
+  // of one full table entry per fault.
+
+  struct FaultInfo {
     uint32_t fault_code = 0U;
     uint32_t attr = 0U;
     uint32_t err_threshold = 1U;
-    bool registered = false;
-    std::atomic<uint32_t> occurrence_count{0U};
     FaultHookFn hook_fn = nullptr;
     void* hook_ctx = nullptr;
   };
 
-  // --- Members ---
-  FaultQueueSet<FaultEntry, QueueLevels, QueueDepth> queue_set_;
-  std::array<FaultTableEntry, MaxFaults> table_{};
+  bool IsRegistered(FaultIndex fault_index) const noexcept {
+    if constexpr (FaultTable::kStatic) {
+      return (kStaticRegistered[fault_index / 64U] & (1ULL << (fault_index % 64U))) != 0U;
+    } else {
+      return (registered_bitmap_[fault_index / 64U] & (1ULL << (fault_index % 64U))) != 0U;
+    }
+  }
 
-  static constexpr uint32_t kBitmapWords = (MaxFaults + 63U) / 64U;
+  uint32_t FaultCodeOf(FaultIndex fault_index) const noexcept {
+    if constexpr (FaultTable::kStatic) {
+      return kStaticTable[fault_index].fault_code;
+    } else {
+      return fault_info_[fault_index].fault_code;
+    }
+  }
+
+  uint32_t ThresholdOf(FaultIndex fault_index) const noexcept {
+    if constexpr (FaultTable::kStatic) {
+      return kStaticTable[fault_index].err_threshold;
+    } else {
+      return fault_info_[fault_index].err_threshold;
+    }
+  }
+
+  /** @brief Single-writer counter update: plain load + store, no locked RMW. */
+  static void AddRelaxed(std::atomic<uint64_t>& counter, uint64_t n) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+  }
+
+  /** @brief Tick interval in ns; 0 if the counter appears to run backwards (cross-core skew). */
+  static uint64_t ElapsedNs(uint64_t from, uint64_t to) noexcept { return (to > from) ? Clock::ToNs(to - from) : 0U; }
+
+  FaultStatistics SumStatistics() const noexcept {
+    FaultStatistics stats{};
+    for (const ProducerStats& ps : producer_stats_) {
+      stats.total_reported += ps.reported.load(std::memory_order_relaxed);
+      stats.total_dropped += ps.dropped.load(std::memory_order_relaxed);
+      stats.total_coalesced += ps.coalesced.load(std::memory_order_relaxed);
+      for (uint32_t i = 0U; i < QueueLevels; ++i) {
+        stats.priority_reported[i] += ps.level_reported[i].load(std::memory_order_relaxed);
+        stats.priority_dropped[i] += ps.level_dropped[i].load(std::memory_order_relaxed);
+      }
+    }
+    stats.total_processed = consumer_stats_.processed.load(std::memory_order_relaxed);
+    stats.total_escalated = consumer_stats_.escalated.load(std::memory_order_relaxed);
+    stats.total_aged = consumer_stats_.aged.load(std::memory_order_relaxed);
+    stats.total_rechecked = consumer_stats_.rechecked.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+  /** @brief Counters written only by the producer that owns the lane. */
+  struct alignas(64) ProducerStats {
+    std::atomic<uint64_t> reported{0U};
+    std::atomic<uint64_t> dropped{0U};
+    std::atomic<uint64_t> coalesced{0U};
+    std::array<std::atomic<uint64_t>, QueueLevels> level_reported{};
+    std::array<std::atomic<uint64_t>, QueueLevels> level_dropped{};
+  };
+
+  /** @brief Counters written only by the consumer. */
+  struct alignas(64) ConsumerStats {
+    std::atomic<uint64_t> processed{0U};
+    std::atomic<uint64_t> escalated{0U};
+    std::atomic<uint64_t> aged{0U};
+    std::atomic<uint64_t> rechecked{0U};
+  };
+
+  struct LatencyStore {
+    std::array<Histogram, QueueLevels> queue{};
+    Histogram hook{};
+  };
+  struct NoLatencyStore {};
+
+  struct CoalesceStore {
+    std::array<uint64_t, (MaxFaults + 63U) / 64U> enabled{};         ///< Written at configuration
+    std::array<std::atomic<uint32_t>, MaxFaults> pending{};          ///< Level | count, see TryCoalesce()
+    std::array<std::atomic<uint32_t>, MaxFaults> latest_detail{};
+  };
+  struct NoCoalesceStore {};
+
+  /** @brief OverflowMode::kDeferred drops: 4 bytes per fault plus a bit per fault, whether used or not. */
+  struct DropStore {
+    std::array<std::atomic<uint32_t>, MaxFaults> counts{};
+    std::array<std::atomic<uint64_t>, kBitmapWords> bitmap{};  ///< Bit per fault with counts != 0
+    std::atomic<bool> pending{false};
+  };
+  struct NoDropStore {};
+
+  struct SnapshotStore {
+    StateSnapshot staging{};  ///< Consumer-only build buffer, keeps large snapshots off the stack
+    SeqLock<StateSnapshot> lock{};
+  };
+  struct NoSnapshotStore {};
+
+  struct RepairStore {
+    std::array<std::atomic<uint64_t>, kBitmapWords> undone{};  ///< Bits undone by refused pushes
+    std::atomic<bool> pending{false};
+    std::array<uint64_t, kBitmapWords> kept{};  ///< Consumer-only: last verdict kept the fault active
+  };
+  struct NoRepairStore {};
+
+  static constexpr uint32_t kNoHookFault = 0xFFFFFFFFU;
+  struct DeferStore {
+    TimerWheel<DeferTimer::kSlots, MaxFaults> wheel{};
+    std::array<FaultEntry, MaxFaults> entry{};  ///< Event to replay per armed fault (priority after escalation)
+    uint32_t hook_fault = kNoHookFault;         ///< Fault whose hook is running, for RequestRecheck()
+    uint32_t request_us = 0U;                   ///< Delay asked for by that hook (0 = none)
+  };
+  struct NoDeferStore {};
+  struct NoCompactHsmStore {};
+
+  struct LaneContext {
+    FaultCollector* owner = nullptr;
+    uint8_t lane = 0U;
+  };
+
+  // --- Members ---
+  FaultQueueSet<QueueEntry, QueueLevels, QueueDepth, MaxProducers, typename Policy::Admission> queue_set_;
+  uint64_t entry_epoch_ = kPackedEntries ? Clock::Now() : 0U;  ///< Base of packed entry timestamps
+  std::array<LaneContext, MaxProducers> lane_ctx_{};
+
+  std::array<uint64_t, kBitmapWords> registered_bitmap_{};          ///< Producer-read, written at registration
+  std::array<std::atomic<uint32_t>, MaxFaults> occurrence_counts_{};  ///< Consumer-hot
+  std::array<FaultInfo, MaxFaults> fault_info_{};                     ///< Cold: code, attr, threshold, hook
+  /// Policy::FaultTable::kStatic: constant registration bitmap and descriptors (replace the two above)
+  static constexpr auto kStaticRegistered = FaultTable::template RegisteredBitmap<MaxFaults>();
+  static constexpr auto kStaticTable = FaultTable::template ByIndex<MaxFaults>();
+  static constexpr uint32_t kSummaryWords = (kBitmapWords + 63U) / 64U;
   std::array<std::atomic<uint64_t>, kBitmapWords> active_bitmap_{};
+  std::array<std::atomic<uint64_t>, kSummaryWords> active_summary_{};  ///< Bit per non-empty leaf word
+  std::atomic<uint32_t> active_count_{0U};  ///< Exact popcount of active_bitmap_, updated on bit flips
 
-  std::atomic<uint64_t> stats_total_reported_{0U};
-  std::atomic<uint64_t> stats_total_processed_{0U};
-  std::atomic<uint64_t> stats_total_dropped_{0U};
-  std::array<std::atomic<uint64_t>, 4U> stats_reported_{};
-  std::array<std::atomic<uint64_t>, 4U> stats_dropped_{};
+  Notifier notifier_{};
+
+  std::array<ProducerStats, MaxProducers> producer_stats_{};  ///< Shard per lane, summed on read
+  ConsumerStats consumer_stats_{};
+  FaultStatistics stats_base_{};  ///< Snapshot taken by ResetStatistics()
+  std::conditional_t<kLatencyHistograms, LatencyStore, NoLatencyStore> latency_{};
+  std::conditional_t<kCoalescing, CoalesceStore, NoCoalesceStore> coalesce_{};
+  std::conditional_t<kDeferredOverflow, DropStore, NoDropStore> drops_{};
+  std::conditional_t<kSnapshots, SnapshotStore, NoSnapshotStore> snapshot_{};
+  std::conditional_t<DeferTimer::kEnabled, DeferStore, NoDeferStore> defer_{};
+  std::conditional_t<kRepairActive, RepairStore, NoRepairStore> repair_{};
 
   FaultHookFn default_hook_fn_ = nullptr;
   void* default_hook_ctx_ = nullptr;
   OverflowFn overflow_fn_ = nullptr;
   void* overflow_ctx_ = nullptr;
+  DeferredOverflowFn deferred_overflow_fn_ = nullptr;
+  void* deferred_overflow_ctx_ = nullptr;
+  OverflowSummaryFn overflow_summary_fn_ = nullptr;
+  void* overflow_summary_ctx_ = nullptr;
   ShutdownFn shutdown_fn_ = nullptr;
   void* shutdown_ctx_ = nullptr;
   BusNotifyFn bus_notify_fn_ = nullptr;
   void* bus_notify_ctx_ = nullptr;
-
-  GlobalHsm global_hsm_;
+  BusFlushFn bus_flush_fn_ = nullptr;
+  RecordFn record_fn_ = nullptr;
+  void* record_ctx_ = nullptr;
+  RecordFlushFn record_flush_fn_ = nullptr;
+  UplinkFn uplink_fn_ = nullptr;
+  void* uplink_ctx_ = nullptr;
+  UplinkFlushFn uplink_flush_fn_ = nullptr;
+
+  GlobalHsmType global_hsm_;
+  std::conditional_t<kCompactHsm, CompactFaultHsmArray<MaxFaults>, NoCompactHsmStore> compact_hsms_{};
   std::array<PerFaultHsm, MaxPerFaultHsm> per_fault_hsms_;
-  std::array<uint16_t, MaxPerFaultHsm> per_fault_hsm_map_{};
+  std::array<uint16_t, MaxFaults> hsm_slot_of_{};  ///< fault_index -> HSM slot + 1 (0 = none)
   uint32_t per_fault_hsm_count_ = 0U;
 
   std::array<RecentFaultInfo, kRecentRingSize> recent_ring_{};
   uint32_t recent_head_ = 0U;
   uint32_t recent_count_ = 0U;
 
+  HsmDispatchMode hsm_mode_ = (MaxProducers > 1U) ? HsmDispatchMode::kOnProcess : HsmDispatchMode::kOnReport;
+  OverflowMode overflow_mode_ = OverflowMode::kImmediate;
   bool shutdown_requested_ = false;
+  std::atomic<bool> degraded_throttling_{false};
 };
 
 }  // namespace fccu
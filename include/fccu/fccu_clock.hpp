@@ -0,0 +1,200 @@
+/**
+ * @file fccu_clock.hpp
+ * @brief Timestamp sources for FaultCollector (Policy::Clock).
+ *
+ * The producer only stores raw ticks (Now()); conversion to microseconds
+ * happens on the consumer (ToUs()) when the FaultEvent is built. A clock
+ * policy provides:
+ *
+ *   static constexpr bool kEnabled;              // false: no timestamps at all
+ *   static uint64_t Now() noexcept;              // raw ticks, monotonic
+ *   static uint64_t ToUs(uint64_t ticks) noexcept;
+ *   static uint64_t ToNs(uint64_t ticks) noexcept;
+ *
+ * Tick differences may be converted as well as absolute values.
+ */
+
+#ifndef FCCU_FCCU_CLOCK_HPP_
+#define FCCU_FCCU_CLOCK_HPP_
+
+#include <cstdint>
+
+#include <atomic>
+#include <chrono>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace fccu {
+
+namespace detail {
+
+/** @brief ticks * num / den without overflowing the intermediate product. */
+inline uint64_t ScaleTicks(uint64_t ticks, uint64_t num, uint64_t den) noexcept {
+  if (den == 0U) {
+    return 0U;
+  }
+  return (ticks / den) * num + ((ticks % den) * num) / den;
+}
+
+}  // namespace detail
+
+// ============================================================================
+// SteadyClock - std::chrono::steady_clock, raw rep (default)
+// ============================================================================
+
+/** @brief Portable default; ticks are steady_clock periods, no conversion on report. */
+struct SteadyClock {
+  static constexpr bool kEnabled = true;
+  using Period = std::chrono::steady_clock::period;
+
+  static uint64_t Now() noexcept {
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+  }
+
+  static uint64_t ToNs(uint64_t ticks) noexcept {
+    return detail::ScaleTicks(ticks, static_cast<uint64_t>(Period::num) * 1000000000U,
+                              static_cast<uint64_t>(Period::den));
+  }
+
+  static uint64_t ToUs(uint64_t ticks) noexcept {
+    return detail::ScaleTicks(ticks, static_cast<uint64_t>(Period::num) * 1000000U,
+                              static_cast<uint64_t>(Period::den));
+  }
+};
+
+// ============================================================================
+// CycleCounterClock - TSC (x86) / CNTVCT_EL0 (AArch64)
+// ============================================================================
+
+/**
+ * @brief Raw CPU counter; one instruction on the report path.
+ *
+ * AArch64 reads the generic timer frequency from CNTFRQ_EL0. x86 calibrates
+ * the TSC against steady_clock once in Calibrate(), which busy-waits for its
+ * window; an invariant TSC is assumed. Other targets fall back to
+ * steady_clock nanoseconds. A FaultCollector using this clock calibrates in
+ * its constructor; elsewhere call Calibrate() at startup. Conversions never
+ * calibrate and return 0 until then.
+ */
+struct CycleCounterClock {
+  static constexpr bool kEnabled = true;
+
+  static uint64_t Now() noexcept {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return static_cast<uint64_t>(__rdtsc());
+#elif defined(__x86_64__) || defined(__i386__)
+    return static_cast<uint64_t>(__rdtsc());
+#elif defined(__aarch64__)
+    uint64_t v;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(v));
+    return v;
+#else
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+#endif
+  }
+
+  /** @brief Counter frequency in Hz (0 before Calibrate()). */
+  static uint64_t FrequencyHz() noexcept { return freq_hz_.load(std::memory_order_relaxed); }
+
+  static bool IsCalibrated() noexcept { return FrequencyHz() != 0U; }
+
+  /**
+   * @brief Measure the counter frequency (call once at startup, off the hot path).
+   * @param window_us Calibration window against steady_clock (x86 only).
+   */
+  static uint64_t Calibrate(uint32_t window_us = 10000U) noexcept {
+    uint64_t hz;
+#if defined(__aarch64__)
+    (void)window_us;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(hz));
+#elif defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    const auto t0 = std::chrono::steady_clock::now();
+    const uint64_t c0 = Now();
+    auto t1 = t0;
+    while (std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count() < window_us) {
+      t1 = std::chrono::steady_clock::now();
+    }
+    const uint64_t c1 = Now();
+    const auto ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+    hz = detail::ScaleTicks(c1 - c0, 1000000000U, ns);
+#else
+    (void)window_us;
+    hz = 1000000000U;
+#endif
+    if (hz == 0U) {
+      hz = 1U;
+    }
+    freq_hz_.store(hz, std::memory_order_relaxed);
+    return hz;
+  }
+
+  static uint64_t ToNs(uint64_t ticks) noexcept { return detail::ScaleTicks(ticks, 1000000000U, FrequencyHz()); }
+
+  static uint64_t ToUs(uint64_t ticks) noexcept { return detail::ScaleTicks(ticks, 1000000U, FrequencyHz()); }
+
+ private:
+  static inline std::atomic<uint64_t> freq_hz_{0U};
+};
+
+// ============================================================================
+// TickClock - coarse cached time, advanced by a periodic task
+// ============================================================================
+
+/**
+ * @brief Report path is a single relaxed load of a cached microsecond value.
+ *
+ * The value is written by one periodic context (e.g. a ztask tick or a
+ * timer ISR) via Set()/Advance(). Resolution equals the tick period.
+ * Tag separates independent tick sources.
+ */
+template <typename Tag = void>
+struct BasicTickClock {
+  static constexpr bool kEnabled = true;
+
+  static uint64_t Now() noexcept { return now_us_.load(std::memory_order_relaxed); }
+
+  static void Set(uint64_t now_us) noexcept { now_us_.store(now_us, std::memory_order_relaxed); }
+
+  /** @brief Single-writer increment (load + store, no RMW). */
+  static void Advance(uint64_t delta_us) noexcept {
+    now_us_.store(now_us_.load(std::memory_order_relaxed) + delta_us, std::memory_order_relaxed);
+  }
+
+  static uint64_t ToNs(uint64_t ticks) noexcept { return ticks * 1000U; }
+
+  static uint64_t ToUs(uint64_t ticks) noexcept { return ticks; }
+
+ private:
+  static inline std::atomic<uint64_t> now_us_{0U};
+};
+
+using TickClock = BasicTickClock<>;
+
+// ============================================================================
+// NullClock - no timestamps
+// ============================================================================
+
+/**
+ * @brief Timestamps and latency figures are always 0.
+ *
+ * ProcessFaults() max_us budgets still apply: they use steady_clock, not Policy::Clock.
+ */
+struct NullClock {
+  static constexpr bool kEnabled = false;
+
+  static uint64_t Now() noexcept { return 0U; }
+
+  static uint64_t ToNs(uint64_t) noexcept { return 0U; }
+
+  static uint64_t ToUs(uint64_t) noexcept { return 0U; }
+};
+
+}  // namespace fccu
+
+#endif  // FCCU_FCCU_CLOCK_HPP_
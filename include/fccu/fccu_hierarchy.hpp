@@ -0,0 +1,179 @@
+/**
+ * @file fccu_hierarchy.hpp
+ * @brief Per-core child collectors feeding one node-level parent collector.
+ *
+ * Each core (or cluster) runs its own FaultCollector, placed and pinned
+ * wherever the caller chooses: its producers, queues, hooks and per-fault
+ * HSMs stay local to that core. FaultAggregator attaches every child to a
+ * parent FaultCollector through one parent producer lane per child, so the
+ * link is the lane's SPSC ring: the child consumer thread is its only
+ * producer and the parent consumer its only reader.
+ *
+ * A child forwards only the events that matter system-wide (SetUplink()):
+ * first occurrences, threshold confirmations and escalations, staged per
+ * child and pushed with one ReportFaultsFrom() at the end of each child
+ * ProcessFaults() (or when the stage fills). The parent processes them as
+ * ordinary reports, so the merged active bitmap, the GlobalHsm and the
+ * system-level hooks have a single owner, the parent consumer.
+ *
+ * Fault indices are shared: register every forwarded fault on the parent
+ * under the same index. The parent needs a claimable lane per attached
+ * child (kClaimableLanes: lane 0 stays with its own ReportFault()), and
+ * sees the forwarded event's detail and final priority; occurrence
+ * counting restarts at the parent.
+ *
+ * Thread safety: Attach() / Detach() during configuration; afterwards each
+ * uplink slot is written only by its child's consumer thread.
+ */
+
+#ifndef FCCU_FCCU_HIERARCHY_HPP_
+#define FCCU_FCCU_HIERARCHY_HPP_
+
+#include "fccu/fccu.hpp"
+
+#include <cstdint>
+
+#include <array>
+#include <atomic>
+
+namespace fccu {
+
+/** @brief Counters of one child uplink. */
+struct UplinkStats {
+  uint64_t forwarded = 0U;  ///< Events admitted into the parent
+  uint64_t dropped = 0U;    ///< Events refused by the parent (full lane, admission, unregistered index)
+  uint64_t flushes = 0U;    ///< ReportFaultsFrom() batches pushed
+};
+
+/**
+ * @brief Collector-of-collectors: forwards child events into a parent collector.
+ *
+ * @tparam Parent      Parent FaultCollector type
+ * @tparam MaxChildren Uplink slots (1..Parent::kClaimableLanes)
+ * @tparam Batch       Events staged per child before a push (1..256)
+ */
+template <typename Parent, uint32_t MaxChildren = Parent::kClaimableLanes, uint32_t Batch = 32U>
+class FaultAggregator {
+  static_assert(MaxChildren >= 1U && MaxChildren <= Parent::kClaimableLanes,
+                "MaxChildren must be 1..Parent::kClaimableLanes (one parent lane per child)");
+  static_assert(Batch >= 1U && Batch <= 256U, "Batch must be 1..256");
+
+ public:
+  static constexpr uint32_t kMaxChildren = MaxChildren;
+  static constexpr uint32_t kInvalidSlot = 0xFFFFFFFFU;
+
+  explicit FaultAggregator(Parent& parent) noexcept : parent_(parent) {}
+
+  FaultAggregator(const FaultAggregator&) = delete;
+  FaultAggregator& operator=(const FaultAggregator&) = delete;
+
+  /**
+   * @brief Claim a parent lane for child and install its uplink.
+   *
+   * @param out_slot Receives the uplink slot for Detach() / GetUplinkStats()
+   * @return kProducerSlotFull when all slots or parent lanes are taken
+   */
+  template <typename Child>
+  FccuError Attach(Child& child, uint32_t& out_slot) noexcept {
+    out_slot = kInvalidSlot;
+    uint32_t slot = 0U;
+    while (slot < MaxChildren && slots_[slot].child != nullptr) {
+      ++slot;
+    }
+    if (slot == MaxChildren) {
+      return FccuError::kProducerSlotFull;
+    }
+    Uplink& u = slots_[slot];
+    FccuError err = parent_.RegisterProducer(u.lane);
+    if (err != FccuError::kOk) {
+      return err;
+    }
+    u.owner = this;
+    u.child = &child;
+    u.unbind = [](void* c) noexcept { static_cast<Child*>(c)->SetUplink(nullptr); };
+    u.count = 0U;
+    child.SetUplink(&Uplink::OnEvent, &u, &Uplink::OnFlush);
+    out_slot = slot;
+    return FccuError::kOk;
+  }
+
+  /** @brief Remove the child's uplink (staged events are pushed first) and release its lane. */
+  void Detach(uint32_t slot) noexcept {
+    if (slot >= MaxChildren || slots_[slot].child == nullptr) {
+      return;
+    }
+    Uplink& u = slots_[slot];
+    u.unbind(u.child);
+    u.Flush();
+    parent_.ReleaseProducer(u.lane);
+    u.child = nullptr;
+  }
+
+  UplinkStats GetUplinkStats(uint32_t slot) const noexcept {
+    UplinkStats s{};
+    if (slot < MaxChildren) {
+      s.forwarded = slots_[slot].forwarded.load(std::memory_order_relaxed);
+      s.dropped = slots_[slot].dropped.load(std::memory_order_relaxed);
+      s.flushes = slots_[slot].flushes.load(std::memory_order_relaxed);
+    }
+    return s;
+  }
+
+  uint32_t ChildCount() const noexcept {
+    uint32_t n = 0U;
+    for (const Uplink& u : slots_) {
+      n += (u.child != nullptr) ? 1U : 0U;
+    }
+    return n;
+  }
+
+  Parent& GetParent() noexcept { return parent_; }
+  const Parent& GetParent() const noexcept { return parent_; }
+
+ private:
+  /** @brief One child's staging buffer and parent lane; written by that child's consumer only. */
+  struct alignas(64) Uplink {
+    FaultAggregator* owner = nullptr;
+    void* child = nullptr;
+    void (*unbind)(void* child) noexcept = nullptr;
+    uint8_t lane = 0U;
+    uint32_t count = 0U;
+    std::array<FaultReport, Batch> staged{};
+    std::atomic<uint64_t> forwarded{0U};
+    std::atomic<uint64_t> dropped{0U};
+    std::atomic<uint64_t> flushes{0U};
+
+    static void OnEvent(const FaultEvent& event, uint8_t /*reasons*/, void* ctx) {
+      auto* u = static_cast<Uplink*>(ctx);
+      u->staged[u->count] = FaultReport{event.fault_index, event.detail, event.priority};
+      if (++u->count == Batch) {
+        u->Flush();
+      }
+    }
+
+    static void OnFlush(void* ctx) { static_cast<Uplink*>(ctx)->Flush(); }
+
+    void Flush() noexcept {
+      if (count == 0U) {
+        return;
+      }
+      FaultBatchResult r = owner->parent_.ReportFaultsFrom(lane, staged.data(), count);
+      AddRelaxed(forwarded, r.admitted + r.coalesced);
+      AddRelaxed(dropped, r.dropped + r.rejected);
+      AddRelaxed(flushes, 1U);
+      count = 0U;
+    }
+
+    /** @brief Single-writer counter update. */
+    static void AddRelaxed(std::atomic<uint64_t>& counter, uint64_t n) noexcept {
+      counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+  };
+
+  Parent& parent_;
+  std::array<Uplink, MaxChildren> slots_{};
+};
+
+}  // namespace fccu
+
+#endif  // FCCU_FCCU_HIERARCHY_HPP_
@@ -9,6 +9,8 @@
  *   Manages individual critical fault lifecycles (optional, max 8).
  *
  * Uses hsm-cpp library for hierarchical state machine with LCA transitions.
+ * CompactGlobalHsm / CompactFaultHsmArray implement the same fixed topology
+ * as constexpr (state, event) tables (FaultCollector Policy::kCompactHsm).
  */
 
 #ifndef FCCU_FCCU_HSM_HPP_
@@ -18,6 +20,9 @@
 
 #include <cstdint>
 
+#include <array>
+#include <atomic>
+
 namespace fccu {
 
 // ============================================================================
@@ -42,6 +47,44 @@ static constexpr uint32_t kClearFault = 14U;     ///< Fault cleared by user/syst
 
 }  // namespace evt
 
+// ============================================================================
+// State IDs (plain values for copying state out, e.g. FaultCollector snapshots)
+// ============================================================================
+
+enum class GlobalState : uint8_t { kIdle = 0U, kActive = 1U, kDegraded = 2U, kShutdown = 3U };
+
+enum class FaultState : uint8_t { kDormant = 0U, kDetected = 1U, kActive = 2U, kRecovering = 3U, kCleared = 4U };
+
+inline const char* GlobalStateName(GlobalState state) noexcept {
+  switch (state) {
+    case GlobalState::kIdle:
+      return "Idle";
+    case GlobalState::kActive:
+      return "Active";
+    case GlobalState::kDegraded:
+      return "Degraded";
+    case GlobalState::kShutdown:
+      return "Shutdown";
+  }
+  return "?";
+}
+
+inline const char* FaultStateName(FaultState state) noexcept {
+  switch (state) {
+    case FaultState::kDormant:
+      return "Dormant";
+    case FaultState::kDetected:
+      return "Detected";
+    case FaultState::kActive:
+      return "Active";
+    case FaultState::kRecovering:
+      return "Recovering";
+    case FaultState::kCleared:
+      return "Cleared";
+  }
+  return "?";
+}
+
 // ============================================================================
 // Global FCCU HSM - System-level fault state machine
 // ============================================================================
@@ -64,6 +107,7 @@ struct GlobalHsmContext {
  *   Idle     -> no active faults
  *   Active   -> faults present, normal processing
  *   Degraded -> critical faults detected, restricted admission
+ *               (FaultCollector::SetDegradedThrottling)
  *   Shutdown -> system shutdown requested
  *
  * Transition diagram:
@@ -87,6 +131,16 @@ class GlobalHsm {
   bool IsDegraded() const noexcept { return sm_.IsInState(degraded_); }
   bool IsShutdown() const noexcept { return sm_.IsInState(shutdown_); }
 
+  GlobalState State() const noexcept {
+    if (IsActive()) {
+      return GlobalState::kActive;
+    }
+    if (IsDegraded()) {
+      return GlobalState::kDegraded;
+    }
+    return IsShutdown() ? GlobalState::kShutdown : GlobalState::kIdle;
+  }
+
   const char* CurrentStateName() const noexcept { return sm_.current_state_name(); }
 
   GlobalHsmContext& context() noexcept { return ctx_; }
@@ -180,6 +234,19 @@ class PerFaultHsm {
   bool IsRecovering() const noexcept { return sm_.IsInState(recovering_); }
   bool IsCleared() const noexcept { return sm_.IsInState(cleared_); }
 
+  FaultState State() const noexcept {
+    if (IsDetected()) {
+      return FaultState::kDetected;
+    }
+    if (IsActive()) {
+      return FaultState::kActive;
+    }
+    if (IsRecovering()) {
+      return FaultState::kRecovering;
+    }
+    return IsCleared() ? FaultState::kCleared : FaultState::kDormant;
+  }
+
   const char* CurrentStateName() const noexcept { return sm_.current_state_name(); }
 
   PerFaultContext& context() noexcept { return ctx_; }
@@ -245,6 +312,162 @@ class PerFaultHsm {
   hsm::StateMachine<PerFaultContext> sm_;
 };
 
+// ============================================================================
+// Compact HSMs - constexpr transition tables over the same topology
+// ============================================================================
+
+/** @brief One (state, event) cell of a compact transition table. */
+struct HsmTransition {
+  uint8_t next;   ///< Target state, kHsmNoTransition if the event is not handled
+  uint8_t flags;  ///< kHsm* guard / action bits
+};
+
+static constexpr uint8_t kHsmNoTransition = 0xFFU;
+static constexpr uint8_t kHsmGuardThreshold = 0x01U;  ///< Taken only if occurrence count >= threshold
+static constexpr uint8_t kHsmClearCounts = 0x02U;     ///< GlobalHsmContext counters reset
+static constexpr uint8_t kHsmSetShutdown = 0x04U;     ///< GlobalHsmContext::shutdown_requested set
+
+namespace detail {
+
+static constexpr HsmTransition kHsmNone{kHsmNoTransition, 0U};
+
+/** @brief Global HSM: rows GlobalState, columns evt::kFaultReported..evt::kDegradeRecovered. */
+static constexpr uint32_t kGlobalEventBase = evt::kFaultReported;
+static constexpr uint32_t kGlobalEvents = evt::kDegradeRecovered - evt::kFaultReported + 1U;
+static constexpr HsmTransition kGlobalTransitions[4][kGlobalEvents] = {
+    // Idle
+    {{1U, 0U}, kHsmNone, kHsmNone, kHsmNone, kHsmNone},
+    // Active
+    {kHsmNone, {0U, kHsmClearCounts}, {2U, 0U}, {3U, kHsmSetShutdown}, kHsmNone},
+    // Degraded
+    {kHsmNone, kHsmNone, kHsmNone, {3U, kHsmSetShutdown}, {1U, 0U}},
+    // Shutdown
+    {kHsmNone, kHsmNone, kHsmNone, kHsmNone, kHsmNone},
+};
+
+/** @brief Per-fault HSM: rows FaultState, columns evt::kDetected..evt::kClearFault. */
+static constexpr uint32_t kFaultEventBase = evt::kDetected;
+static constexpr uint32_t kFaultEvents = evt::kClearFault - evt::kDetected + 1U;
+static constexpr HsmTransition kFaultTransitions[5][kFaultEvents] = {
+    // Dormant
+    {{1U, 0U}, kHsmNone, kHsmNone, kHsmNone, kHsmNone},
+    // Detected (kDetected is internal: the count lives in the collector)
+    {{1U, 0U}, {2U, kHsmGuardThreshold}, kHsmNone, kHsmNone, {4U, 0U}},
+    // Active
+    {kHsmNone, kHsmNone, {3U, 0U}, kHsmNone, {4U, 0U}},
+    // Recovering
+    {kHsmNone, kHsmNone, kHsmNone, {4U, 0U}, kHsmNone},
+    // Cleared
+    {kHsmNone, kHsmNone, kHsmNone, kHsmNone, {0U, 0U}},
+};
+
+/** @brief Table cell for (state, event), or kHsmNone for an event outside the table's range. */
+template <size_t kStates, size_t kEvents>
+constexpr HsmTransition LookupTransition(const HsmTransition (&table)[kStates][kEvents], uint8_t state,
+                                         uint32_t base, uint32_t event_id) noexcept {
+  return (event_id >= base && event_id - base < kEvents && state < kStates) ? table[state][event_id - base]
+                                                                            : kHsmNone;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Table-driven GlobalHsm: same states, events and context, one byte of state.
+ *
+ * Drop-in for GlobalHsm (Dispatch, state queries, context, Reset); no
+ * per-instance state graph and no std::function dispatch.
+ */
+class CompactGlobalHsm {
+ public:
+  bool Dispatch(uint32_t event_id) noexcept {
+    const HsmTransition t =
+        detail::LookupTransition(detail::kGlobalTransitions, state_, detail::kGlobalEventBase, event_id);
+    if (t.next == kHsmNoTransition) {
+      return false;
+    }
+    if ((t.flags & kHsmClearCounts) != 0U) {
+      ctx_.active_count = 0U;
+      ctx_.critical_count = 0U;
+    }
+    if ((t.flags & kHsmSetShutdown) != 0U) {
+      ctx_.shutdown_requested = true;
+    }
+    state_ = t.next;
+    return true;
+  }
+
+  bool IsIdle() const noexcept { return State() == GlobalState::kIdle; }
+  bool IsActive() const noexcept { return State() == GlobalState::kActive; }
+  bool IsDegraded() const noexcept { return State() == GlobalState::kDegraded; }
+  bool IsShutdown() const noexcept { return State() == GlobalState::kShutdown; }
+
+  GlobalState State() const noexcept { return static_cast<GlobalState>(state_); }
+  const char* CurrentStateName() const noexcept { return GlobalStateName(State()); }
+
+  GlobalHsmContext& context() noexcept { return ctx_; }
+  const GlobalHsmContext& context() const noexcept { return ctx_; }
+
+  void Reset() noexcept {
+    ctx_ = GlobalHsmContext{};
+    state_ = 0U;
+  }
+
+ private:
+  GlobalHsmContext ctx_;
+  uint8_t state_ = 0U;  ///< GlobalState
+};
+
+/**
+ * @brief Table-driven per-fault lifecycle for N faults, one byte each.
+ *
+ * Same topology as PerFaultHsm. The occurrence count and threshold are
+ * not stored here: the caller passes them to Dispatch() for the
+ * Detected -> Active guard (FaultCollector keeps both per fault anyway).
+ * States are relaxed atomics so other threads can read them while the
+ * owning thread dispatches.
+ */
+template <uint32_t N>
+class CompactFaultHsmArray {
+ public:
+  bool Dispatch(uint32_t fault_index, uint32_t event_id, uint32_t occurrence_count = 0U,
+                uint32_t threshold = 1U) noexcept {
+    if (fault_index >= N) {
+      return false;
+    }
+    const uint8_t state = states_[fault_index].load(std::memory_order_relaxed);
+    const HsmTransition t =
+        detail::LookupTransition(detail::kFaultTransitions, state, detail::kFaultEventBase, event_id);
+    if (t.next == kHsmNoTransition) {
+      return false;
+    }
+    if ((t.flags & kHsmGuardThreshold) != 0U && occurrence_count < threshold) {
+      return false;
+    }
+    states_[fault_index].store(t.next, std::memory_order_relaxed);
+    return true;
+  }
+
+  FaultState State(uint32_t fault_index) const noexcept {
+    return (fault_index < N) ? static_cast<FaultState>(states_[fault_index].load(std::memory_order_relaxed))
+                             : FaultState::kDormant;
+  }
+
+  void Reset(uint32_t fault_index) noexcept {
+    if (fault_index < N) {
+      states_[fault_index].store(0U, std::memory_order_relaxed);
+    }
+  }
+
+  void ResetAll() noexcept {
+    for (auto& s : states_) {
+      s.store(0U, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  std::array<std::atomic<uint8_t>, N> states_{};  ///< FaultState
+};
+
 }  // namespace fccu
 
 #endif  // FCCU_FCCU_HSM_HPP_
@@ -0,0 +1,242 @@
+/**
+ * @file fccu_mccc_bridge.hpp
+ * @brief Batched FaultCollector <-> mccc::AsyncBus adapters.
+ *
+ * FaultBusPublisher (egress): stages each processed FaultEvent as a compact
+ * FaultRecord directly inside the bus payload and publishes the staged batch
+ * once at the end of every ProcessFaults() call (or when it fills up).
+ *
+ * FaultBusIngress (ingress): subscribes to FaultReportBatch messages and
+ * forwards each one into ReportFaultsFrom() as a single bulk report.
+ *
+ * Both message types are trivially copyable PODs; add the ones you use to
+ * the bus payload variant:
+ * @code
+ * using Payload = std::variant<fccu::FaultRecordBatch<16>, fccu::FaultReportBatch<16>, ...>;
+ * using Bus = mccc::AsyncBus<Payload>;
+ *
+ * fccu::FaultBusPublisher<Payload> publisher(bus);
+ * publisher.Attach(collector);
+ * fccu::FaultBusIngress<decltype(collector), Payload> ingress(collector, bus);
+ * @endcode
+ *
+ * Only this header depends on mccc; fccu.hpp does not.
+ */
+
+#ifndef FCCU_FCCU_MCCC_BRIDGE_HPP_
+#define FCCU_FCCU_MCCC_BRIDGE_HPP_
+
+#include "fccu/fccu.hpp"
+#include "mccc/message_bus.hpp"
+
+#include <cstdint>
+
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace fccu {
+
+// ============================================================================
+// Bus Message Types
+// ============================================================================
+
+/** @brief One processed fault on the bus (24 bytes, no padding). */
+struct FaultRecord {
+  uint64_t timestamp_us;
+  uint32_t fault_code;
+  uint32_t detail;
+  uint32_t occurrence_count;  ///< Includes coalesced reports
+  FaultIndex fault_index;
+  uint8_t priority;  ///< FaultPriority
+  uint8_t is_first;
+};
+
+static_assert(sizeof(FaultRecord) == 24U, "FaultRecord layout changed");
+
+/** @brief Egress message: the faults processed by one ProcessFaults() call. */
+template <uint32_t Capacity>
+struct FaultRecordBatch {
+  static constexpr uint32_t kCapacity = Capacity;
+
+  uint32_t count = 0U;
+  std::array<FaultRecord, Capacity> records;  ///< First count entries valid
+};
+
+/** @brief Ingress message: reports forwarded into ReportFaultsFrom(). */
+template <uint32_t Capacity>
+struct FaultReportBatch {
+  static constexpr uint32_t kCapacity = Capacity;
+
+  uint32_t count = 0U;
+  std::array<FaultReport, Capacity> reports;  ///< First count entries valid
+
+  /** @return false when the batch is full */
+  bool Add(FaultIndex fault_index, uint32_t detail = 0U, FaultPriority priority = FaultPriority::kMedium) noexcept {
+    if (count >= Capacity) {
+      return false;
+    }
+    reports[count++] = FaultReport{fault_index, detail, priority};
+    return true;
+  }
+};
+
+// ============================================================================
+// FaultBusPublisher - consumer -> bus
+// ============================================================================
+
+/**
+ * @brief Publishes processed faults as FaultRecordBatch, one bus message per batch.
+ *
+ * Records are written straight into the staged payload variant, so a flush
+ * is a single Publish() with no per-event construction. All calls happen on
+ * the collector's consumer thread.
+ *
+ * @tparam PayloadVariant Bus payload variant; must hold FaultRecordBatch<BatchCapacity>
+ * @tparam BatchCapacity  Records per bus message (default: 16, one drain block)
+ * @tparam BusT           Bus with mccc's bool Publish(PayloadVariant&&, uint32_t) (default: mccc::AsyncBus)
+ */
+template <typename PayloadVariant, uint32_t BatchCapacity = 16U, typename BusT = mccc::AsyncBus<PayloadVariant>>
+class FaultBusPublisher {
+  static_assert(BatchCapacity >= 1U, "BatchCapacity must be >= 1");
+
+ public:
+  using Bus = BusT;
+  using Batch = FaultRecordBatch<BatchCapacity>;
+  static_assert(std::is_trivially_copyable<Batch>::value, "bus payloads must be trivially copyable");
+
+  explicit FaultBusPublisher(Bus& bus, uint32_t sender_id = 0U) noexcept
+      : bus_(bus), sender_id_(sender_id), pending_(std::in_place_type<Batch>) {}
+
+  FaultBusPublisher(const FaultBusPublisher&) = delete;
+  FaultBusPublisher& operator=(const FaultBusPublisher&) = delete;
+
+  /** @brief Install this publisher as the collector's bus notifier (replaces any previous one). */
+  template <typename Collector>
+  void Attach(Collector& collector) noexcept {
+    collector.SetBusNotifier(&FaultBusPublisher::OnEvent, this, &FaultBusPublisher::OnFlush);
+  }
+
+  /** @brief Publish staged records now (normally done by ProcessFaults()). */
+  void Flush() noexcept {
+    Batch& batch = Staged();
+    if (batch.count == 0U) {
+      return;
+    }
+    const uint32_t n = batch.count;
+    if (bus_.Publish(std::move(pending_), sender_id_)) {
+      ++published_batches_;
+      published_records_ += n;
+    } else {
+      dropped_records_ += n;
+    }
+    // The moved-from alternative is still a Batch (trivially copyable)
+    Staged().count = 0U;
+  }
+
+  uint32_t PendingCount() const noexcept { return std::get_if<Batch>(&pending_)->count; }
+  uint64_t PublishedBatches() const noexcept { return published_batches_; }
+  uint64_t PublishedRecords() const noexcept { return published_records_; }
+  uint64_t DroppedRecords() const noexcept { return dropped_records_; }  ///< Refused by the bus
+
+ private:
+  Batch& Staged() noexcept { return *std::get_if<Batch>(&pending_); }
+
+  void Append(const FaultEvent& event) noexcept {
+    Batch& batch = Staged();
+    if (batch.count == BatchCapacity) {
+      Flush();
+    }
+    FaultRecord& rec = batch.records[batch.count++];
+    rec.timestamp_us = event.timestamp_us;
+    rec.fault_code = event.fault_code;
+    rec.detail = event.detail;
+    rec.occurrence_count = event.occurrence_count;
+    rec.fault_index = event.fault_index;
+    rec.priority = static_cast<uint8_t>(event.priority);
+    rec.is_first = event.is_first ? 1U : 0U;
+  }
+
+  static void OnEvent(const FaultEvent& event, void* ctx) noexcept {
+    static_cast<FaultBusPublisher*>(ctx)->Append(event);
+  }
+
+  static void OnFlush(void* ctx) noexcept { static_cast<FaultBusPublisher*>(ctx)->Flush(); }
+
+  Bus& bus_;
+  uint32_t sender_id_;
+  PayloadVariant pending_;
+  uint64_t published_batches_ = 0U;
+  uint64_t published_records_ = 0U;
+  uint64_t dropped_records_ = 0U;
+};
+
+// ============================================================================
+// FaultBusIngress - bus -> producer lane
+// ============================================================================
+
+/**
+ * @brief Forwards FaultReportBatch messages into ReportFaultsFrom().
+ *
+ * Subscribes on construction and unsubscribes on destruction. The bus
+ * dispatch thread (the one calling ProcessBatch()) acts as the producer of
+ * lane, so with MaxProducers > 1 claim that lane on it first.
+ *
+ * @tparam Collector      FaultCollector instantiation
+ * @tparam PayloadVariant Bus payload variant; must hold FaultReportBatch<BatchCapacity>
+ * @tparam BatchCapacity  Reports per bus message (default: 16)
+ */
+template <typename Collector, typename PayloadVariant, uint32_t BatchCapacity = 16U>
+class FaultBusIngress {
+  static_assert(BatchCapacity >= 1U, "BatchCapacity must be >= 1");
+
+ public:
+  using Bus = mccc::AsyncBus<PayloadVariant>;
+  using Batch = FaultReportBatch<BatchCapacity>;
+  static_assert(std::is_trivially_copyable<Batch>::value, "bus payloads must be trivially copyable");
+
+  FaultBusIngress(Collector& collector, Bus& bus, uint8_t lane = 0U)
+      : collector_(collector), bus_(bus), lane_(lane) {
+    handle_ = bus_.template Subscribe<Batch>(
+        [this](const typename Bus::EnvelopeType& env) { OnMessage(env); });
+  }
+
+  ~FaultBusIngress() { (void)bus_.Unsubscribe(handle_); }
+
+  FaultBusIngress(const FaultBusIngress&) = delete;
+  FaultBusIngress& operator=(const FaultBusIngress&) = delete;
+
+  /** @brief Accumulated ReportFaultsFrom() results over all forwarded batches. */
+  const FaultBatchResult& Totals() const noexcept { return totals_; }
+  uint64_t BatchesForwarded() const noexcept { return batches_; }
+
+ private:
+  using Handle = decltype(std::declval<Bus&>().template Subscribe<Batch>(
+      std::declval<void (*)(const typename Bus::EnvelopeType&)>()));
+
+  void OnMessage(const typename Bus::EnvelopeType& env) noexcept {
+    const Batch* batch = std::get_if<Batch>(&env.payload);
+    if (batch == nullptr) {
+      return;
+    }
+    uint32_t n = (batch->count < BatchCapacity) ? batch->count : BatchCapacity;
+    FaultBatchResult r = collector_.ReportFaultsFrom(lane_, batch->reports.data(), n);
+    totals_.admitted += r.admitted;
+    totals_.dropped += r.dropped;
+    totals_.rejected += r.rejected;
+    totals_.coalesced += r.coalesced;
+    ++batches_;
+  }
+
+  Collector& collector_;
+  Bus& bus_;
+  uint8_t lane_;
+  Handle handle_{};
+  FaultBatchResult totals_{};
+  uint64_t batches_ = 0U;
+};
+
+}  // namespace fccu
+
+#endif  // FCCU_FCCU_MCCC_BRIDGE_HPP_
@@ -0,0 +1,219 @@
+/**
+ * @file fccu_notifier.hpp
+ * @brief Consumer wakeup notifiers for FaultCollector::WaitAndProcess().
+ *
+ * Select one through Policy::Notifier. The default (NullNotifier, in
+ * fccu.hpp) compiles the wakeup path out, keeping fccu.hpp free of OS
+ * headers; include this file only when a blocking consumer is wanted.
+ *
+ * All notifiers share the same sequence / waiter-count protocol:
+ *
+ *   consumer: token = PrepareWait();  re-check for work;  Wait(token, timeout)
+ *   producer: publish work;  Notify()
+ *
+ * Notify() bumps the sequence and only enters the kernel when a waiter is
+ * registered. Wait() registers itself, then blocks only while the sequence
+ * still equals the token, so a Notify() racing with the re-check is never
+ * lost. Spurious returns are allowed; callers always re-check.
+ *
+ * kProcessShared marks notifiers that still work when the collector lives
+ * in shared memory and producers are other processes (see fccu_shm.hpp).
+ */
+
+#ifndef FCCU_FCCU_NOTIFIER_HPP_
+#define FCCU_FCCU_NOTIFIER_HPP_
+
+#include <cerrno>
+#include <cstdint>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace fccu {
+
+// ============================================================================
+// CondVarNotifier - portable (std::mutex + std::condition_variable)
+// ============================================================================
+
+class CondVarNotifier {
+ public:
+  static constexpr bool kEnabled = true;
+  static constexpr bool kProcessShared = false;
+
+  void Notify() noexcept {
+    seq_.fetch_add(1U, std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_seq_cst) != 0U) {
+      // Taking the lock orders this notify after the waiter's predicate check
+      { std::lock_guard<std::mutex> lock(mutex_); }
+      cv_.notify_one();
+    }
+  }
+
+  uint32_t PrepareWait() const noexcept { return seq_.load(std::memory_order_acquire); }
+
+  /**
+   * @param token      Value returned by PrepareWait()
+   * @param timeout_us Maximum block time (0 = no timeout)
+   * @return false on timeout
+   */
+  bool Wait(uint32_t token, uint32_t timeout_us) noexcept {
+    std::unique_lock<std::mutex> lock(mutex_);
+    waiters_.fetch_add(1U, std::memory_order_seq_cst);
+    auto changed = [this, token]() { return seq_.load(std::memory_order_seq_cst) != token; };
+    bool woken = true;
+    if (timeout_us == 0U) {
+      cv_.wait(lock, changed);
+    } else {
+      woken = cv_.wait_for(lock, std::chrono::microseconds(timeout_us), changed);
+    }
+    waiters_.fetch_sub(1U, std::memory_order_relaxed);
+    return woken;
+  }
+
+ private:
+  std::atomic<uint32_t> seq_{0U};
+  std::atomic<uint32_t> waiters_{0U};
+  std::mutex mutex_;
+  std::condition_variable cv_;
+};
+
+#if defined(__linux__)
+
+namespace detail {
+
+inline timespec MicrosToTimespec(uint32_t us) noexcept {
+  timespec ts{};
+  ts.tv_sec = static_cast<time_t>(us / 1000000U);
+  ts.tv_nsec = static_cast<long>((us % 1000000U) * 1000U);  // NOLINT(runtime/int)
+  return ts;
+}
+
+}  // namespace detail
+
+// ============================================================================
+// FutexNotifier - Linux futex on the sequence word
+// ============================================================================
+
+/**
+ * @brief Cheapest blocking wakeup on Linux: one FUTEX_WAKE only when parked.
+ *
+ * @tparam Shared Use non-private futex ops, so producers in other processes
+ *                mapping the same memory can wake the consumer
+ */
+template <bool Shared>
+class BasicFutexNotifier {
+ public:
+  static constexpr bool kEnabled = true;
+  static constexpr bool kProcessShared = Shared;
+
+  void Notify() noexcept {
+    seq_.fetch_add(1U, std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_seq_cst) != 0U) {
+      (void)syscall(SYS_futex, reinterpret_cast<uint32_t*>(&seq_), kWakeOp, 1, nullptr, nullptr, 0);
+    }
+  }
+
+  uint32_t PrepareWait() const noexcept { return seq_.load(std::memory_order_acquire); }
+
+  /** @copydoc CondVarNotifier::Wait */
+  bool Wait(uint32_t token, uint32_t timeout_us) noexcept {
+    waiters_.fetch_add(1U, std::memory_order_seq_cst);
+    timespec ts = detail::MicrosToTimespec(timeout_us);
+    // The kernel re-compares seq_ with token atomically before sleeping
+    long rc = syscall(SYS_futex, reinterpret_cast<uint32_t*>(&seq_), kWaitOp, token,  // NOLINT(runtime/int)
+                      (timeout_us == 0U) ? nullptr : &ts, nullptr, 0);
+    waiters_.fetch_sub(1U, std::memory_order_relaxed);
+    return !(rc != 0 && errno == ETIMEDOUT);
+  }
+
+ private:
+  static constexpr int kWakeOp = Shared ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE;
+  static constexpr int kWaitOp = Shared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE;
+  static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be a plain 32-bit integer");
+  std::atomic<uint32_t> seq_{0U};
+  std::atomic<uint32_t> waiters_{0U};
+};
+
+using FutexNotifier = BasicFutexNotifier<false>;
+using SharedFutexNotifier = BasicFutexNotifier<true>;  ///< Cross-process (fccu_shm.hpp)
+
+// ============================================================================
+// EventFdNotifier - Linux eventfd, pollable from an external event loop
+// ============================================================================
+
+/**
+ * @brief Wakeup through an eventfd.
+ *
+ * NativeHandle() can also be registered with epoll/poll in the consumer's
+ * own event loop; call Drain() after it becomes readable.
+ */
+class EventFdNotifier {
+ public:
+  static constexpr bool kEnabled = true;
+  static constexpr bool kProcessShared = false;  ///< The fd is per process
+
+  EventFdNotifier() noexcept : fd_(eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC)) {}
+  ~EventFdNotifier() {
+    if (fd_ >= 0) {
+      (void)close(fd_);
+    }
+  }
+  EventFdNotifier(const EventFdNotifier&) = delete;
+  EventFdNotifier& operator=(const EventFdNotifier&) = delete;
+
+  bool IsValid() const noexcept { return fd_ >= 0; }
+  int NativeHandle() const noexcept { return fd_; }
+
+  void Notify() noexcept {
+    seq_.fetch_add(1U, std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_seq_cst) != 0U && fd_ >= 0) {
+      uint64_t one = 1U;
+      (void)write(fd_, &one, sizeof(one));
+    }
+  }
+
+  uint32_t PrepareWait() const noexcept { return seq_.load(std::memory_order_acquire); }
+
+  /** @copydoc CondVarNotifier::Wait */
+  bool Wait(uint32_t token, uint32_t timeout_us) noexcept {
+    waiters_.fetch_add(1U, std::memory_order_seq_cst);
+    bool woken = true;
+    if (seq_.load(std::memory_order_seq_cst) == token && fd_ >= 0) {
+      pollfd pfd{fd_, POLLIN, 0};
+      timespec ts = detail::MicrosToTimespec(timeout_us);
+      int rc = ppoll(&pfd, 1U, (timeout_us == 0U) ? nullptr : &ts, nullptr);
+      woken = (rc > 0);
+      Drain();
+    }
+    waiters_.fetch_sub(1U, std::memory_order_relaxed);
+    return woken;
+  }
+
+  /** @brief Reset the eventfd counter (non-blocking). */
+  void Drain() noexcept {
+    uint64_t value = 0U;
+    (void)read(fd_, &value, sizeof(value));
+  }
+
+ private:
+  int fd_;
+  std::atomic<uint32_t> seq_{0U};
+  std::atomic<uint32_t> waiters_{0U};
+};
+
+#endif  // __linux__
+
+}  // namespace fccu
+
+#endif  // FCCU_FCCU_NOTIFIER_HPP_
@@ -0,0 +1,379 @@
+/**
+ * @file fccu_sharded.hpp
+ * @brief FaultCollector sharded by fault index across N consumer workers.
+ *
+ * ShardedFaultCollector owns Shards independent FaultCollector instances.
+ * A fault belongs to shard (fault_index % Shards): its reports are queued,
+ * processed and hooked there only, so per-fault ordering, occurrence_count
+ * and the per-fault HSM behave exactly as with a single collector, while a
+ * slow hook only holds up the faults of its own shard. Each shard is
+ * drained by its own worker thread (ProcessShard(), WaitAndProcessShard()),
+ * strictly by priority within the shard.
+ *
+ * Cross-shard state is merged in one lightweight aggregation step:
+ * shards run with Policy::kSnapshots forced on, and Aggregate() combines
+ * their lock-free snapshots (statistics, active count, queue depths, the
+ * most severe global state, recent faults newest first) and drives an
+ * aggregate CompactGlobalHsm. Neither readers nor the aggregator ever
+ * block a worker.
+ *
+ * Thread safety: configuration before the workers start; producers as
+ * with FaultCollector (RegisterProducer() claims the same lane in every
+ * shard); ProcessShard(i) / ClearFault() of a fault owned by shard i only
+ * on worker i; Aggregate() from one thread at a time. Hooks of different
+ * shards run concurrently. Admission throttling and shutdown act per
+ * shard: a kShutdown hook stops its own shard, IsShutdownRequested()
+ * reports any.
+ */
+
+#ifndef FCCU_FCCU_SHARDED_HPP_
+#define FCCU_FCCU_SHARDED_HPP_
+
+#include "fccu/fccu.hpp"
+
+#include <cstdint>
+
+#include <array>
+
+namespace fccu {
+
+/**
+ * @brief N FaultCollector shards behind one reporting / configuration front.
+ *
+ * @tparam Shards Number of shards and consumer workers (1..32)
+ * Remaining parameters as FaultCollector, applied to every shard. Each
+ * shard is sized for the full MaxFaults so fault indices are never
+ * remapped; MaxPerFaultHsm and QueueDepth are per shard.
+ */
+template <uint32_t Shards, uint32_t MaxFaults = 64U, uint32_t QueueDepth = 32U, uint32_t QueueLevels = 4U,
+          uint32_t MaxPerFaultHsm = 8U, uint32_t MaxProducers = 1U, typename Policy = DefaultCollectorPolicy>
+class ShardedFaultCollector {
+  static_assert(Shards >= 1U && Shards <= 32U, "Shards must be 1..32");
+
+ public:
+  struct ShardPolicy : Policy {
+    static constexpr bool kSnapshots = true;  ///< Aggregate() reads the shard snapshots
+  };
+  using Shard = FaultCollector<MaxFaults, QueueDepth, QueueLevels, MaxPerFaultHsm, MaxProducers, ShardPolicy>;
+  using Notifier = typename Shard::Notifier;
+
+  static constexpr uint32_t kShards = Shards;
+  static constexpr uint32_t kRecentRingSize = Shard::kRecentRingSize;
+
+  /** @brief Merged cross-shard view produced by Aggregate(). */
+  struct AggregateState {
+    GlobalState global_state = GlobalState::kIdle;  ///< Most severe shard state
+    uint32_t shards_read = 0U;                      ///< Shards with a published snapshot that was read
+    uint32_t active_count = 0U;
+    FaultStatistics stats{};
+    std::array<uint32_t, QueueLevels> queue_depth{};
+    uint32_t recent_count = 0U;
+    std::array<RecentFaultInfo, kRecentRingSize> recent{};  ///< Newest first over all shards
+  };
+
+  static constexpr uint32_t ShardOf(FaultIndex fault_index) noexcept { return fault_index % Shards; }
+
+  // --- Configuration (call before the workers start) ---
+
+  FccuError RegisterFault(FaultIndex fault_index, uint32_t fault_code, uint32_t attr = 0U,
+                          uint32_t err_threshold = 1U) noexcept {
+    return shards_[ShardOf(fault_index)].RegisterFault(fault_index, fault_code, attr, err_threshold);
+  }
+
+  /** @brief The hook runs on the worker of the fault's shard. */
+  FccuError RegisterHook(FaultIndex fault_index, FaultHookFn fn, void* ctx = nullptr) noexcept {
+    return shards_[ShardOf(fault_index)].RegisterHook(fault_index, fn, ctx);
+  }
+
+  /** @brief Default hook for every shard; it may run on several workers at once. */
+  void SetDefaultHook(FaultHookFn fn, void* ctx = nullptr) noexcept {
+    for (Shard& s : shards_) {
+      s.SetDefaultHook(fn, ctx);
+    }
+  }
+
+  FccuError BindFaultHsm(FaultIndex fault_index, uint32_t threshold = 1U) noexcept {
+    return shards_[ShardOf(fault_index)].BindFaultHsm(fault_index, threshold);
+  }
+
+  /** @brief Apply fn(Shard&) to every shard, e.g. to install callbacks or a recorder. */
+  template <typename Fn>
+  void ForEachShard(Fn&& fn) {
+    for (Shard& s : shards_) {
+      fn(s);
+    }
+  }
+
+  Shard& GetShard(uint32_t shard) noexcept { return shards_[shard]; }
+  const Shard& GetShard(uint32_t shard) const noexcept { return shards_[shard]; }
+
+  // --- Producer lanes ---
+
+  /** @brief Claim the same lane in every shard. */
+  FccuError RegisterProducer(uint8_t& out_lane) noexcept {
+    FccuError err = shards_[0].RegisterProducer(out_lane);
+    if (err != FccuError::kOk) {
+      return err;
+    }
+    for (uint32_t i = 1U; i < Shards; ++i) {
+      uint8_t lane = 0U;
+      err = shards_[i].RegisterProducer(lane);
+      if (err != FccuError::kOk || lane != out_lane) {
+        // Lanes were claimed outside this front: undo and refuse
+        if (err == FccuError::kOk) {
+          shards_[i].ReleaseProducer(lane);
+        }
+        for (uint32_t j = 0U; j < i; ++j) {
+          shards_[j].ReleaseProducer(out_lane);
+        }
+        return FccuError::kProducerSlotFull;
+      }
+    }
+    return FccuError::kOk;
+  }
+
+  void ReleaseProducer(uint8_t lane) noexcept {
+    for (Shard& s : shards_) {
+      s.ReleaseProducer(lane);
+    }
+  }
+
+  // --- Reporting (producer side) ---
+
+  FccuError ReportFault(FaultIndex fault_index, uint32_t detail = 0U,
+                        FaultPriority priority = FaultPriority::kMedium) noexcept {
+    return ReportFaultFrom(0U, fault_index, detail, priority);
+  }
+
+  FccuError ReportFaultFrom(uint8_t lane, FaultIndex fault_index, uint32_t detail = 0U,
+                            FaultPriority priority = FaultPriority::kMedium) noexcept {
+    return shards_[ShardOf(fault_index)].ReportFaultFrom(lane, fault_index, detail, priority);
+  }
+
+  FaultBatchResult ReportFaults(const FaultReport* reports, uint32_t count, FccuError* out_errors = nullptr) noexcept {
+    return ReportFaultsFrom(0U, reports, count, out_errors);
+  }
+
+  /**
+   * @brief Split a batch by shard and forward each part with one ReportFaultsFrom() per chunk.
+   *
+   * Reports keep their relative order within a shard (and so per fault).
+   */
+  FaultBatchResult ReportFaultsFrom(uint8_t lane, const FaultReport* reports, uint32_t count,
+                                    FccuError* out_errors = nullptr) noexcept {
+    FaultBatchResult total{};
+    if (reports == nullptr || count == 0U) {
+      return total;
+    }
+    std::array<FaultReport, kRouteChunk> chunk;
+    std::array<uint32_t, kRouteChunk> src;
+    std::array<FccuError, kRouteChunk> errors;
+    for (uint32_t s = 0U; s < Shards; ++s) {
+      uint32_t n = 0U;
+      auto flush = [&]() noexcept {
+        FaultBatchResult r = shards_[s].ReportFaultsFrom(lane, chunk.data(), n, errors.data());
+        total.admitted += r.admitted;
+        total.dropped += r.dropped;
+        total.rejected += r.rejected;
+        total.coalesced += r.coalesced;
+        for (uint32_t k = 0U; out_errors != nullptr && k < n; ++k) {
+          out_errors[src[k]] = errors[k];
+        }
+        n = 0U;
+      };
+      for (uint32_t i = 0U; i < count; ++i) {
+        if (ShardOf(reports[i].fault_index) != s) {
+          continue;
+        }
+        chunk[n] = reports[i];
+        src[n] = i;
+        if (++n == kRouteChunk) {
+          flush();
+        }
+      }
+      if (n > 0U) {
+        flush();
+      }
+    }
+    return total;
+  }
+
+  /** @brief FaultReporter routing through a producer lane (lane 0 for single-producer use). */
+  FaultReporter GetReporter(uint8_t lane = 0U) noexcept {
+    FaultReporter reporter{};
+    if (lane >= MaxProducers) {
+      return reporter;
+    }
+    lane_ctx_[lane].owner = this;
+    lane_ctx_[lane].lane = lane;
+    reporter.fn = [](FaultIndex fi, uint32_t det, FaultPriority pri, void* ctx) {
+      auto* lc = static_cast<LaneContext*>(ctx);
+      lc->owner->ReportFaultFrom(lc->lane, fi, det, pri);
+    };
+    reporter.ctx = &lane_ctx_[lane];
+    return reporter;
+  }
+
+  // --- Processing (one worker thread per shard) ---
+
+  /** @brief Drain one shard (its worker thread only); see FaultCollector::ProcessFaults(). */
+  uint32_t ProcessShard(uint32_t shard, uint32_t max_items = 0U, uint32_t max_us = 0U) noexcept {
+    return (shard < Shards) ? shards_[shard].ProcessFaults(max_items, max_us) : 0U;
+  }
+
+  /** @brief Blocking worker loop body for one shard; see FaultCollector::WaitAndProcess(). */
+  uint32_t WaitAndProcessShard(uint32_t shard, uint32_t timeout_us = 0U, uint32_t max_items = 0U) noexcept {
+    return (shard < Shards) ? shards_[shard].WaitAndProcess(timeout_us, max_items) : 0U;
+  }
+
+  /** @brief Wake every parked worker (e.g. to stop them). */
+  void NotifyWorkers() noexcept {
+    for (Shard& s : shards_) {
+      s.NotifyConsumer();
+    }
+  }
+
+  // --- Query ---
+
+  bool IsFaultActive(FaultIndex fault_index) const noexcept {
+    return shards_[ShardOf(fault_index)].IsFaultActive(fault_index);
+  }
+
+  uint32_t ActiveFaultCount() const noexcept {
+    uint32_t n = 0U;
+    for (const Shard& s : shards_) {
+      n += s.ActiveFaultCount();
+    }
+    return n;
+  }
+
+  /** @brief Clear a fault (on the worker thread of its shard). */
+  void ClearFault(FaultIndex fault_index) noexcept { shards_[ShardOf(fault_index)].ClearFault(fault_index); }
+
+  /** @brief FaultCollector::RequestRecheck() on the fault's shard (from its hook, on that worker). */
+  FccuError RequestRecheck(FaultIndex fault_index, uint32_t delay_us) noexcept {
+    return shards_[ShardOf(fault_index)].RequestRecheck(fault_index, delay_us);
+  }
+
+  FaultStatistics GetStatistics() const noexcept {
+    FaultStatistics total{};
+    for (const Shard& s : shards_) {
+      Accumulate(total, s.GetStatistics());
+    }
+    return total;
+  }
+
+  bool IsShutdownRequested() const noexcept {
+    for (const Shard& s : shards_) {
+      if (s.IsShutdownRequested()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // --- Aggregation ---
+
+  /**
+   * @brief Merge the latest shard snapshots and advance the aggregate global HSM.
+   *
+   * Call from one thread at a time (a monitor, or one of the workers after
+   * its ProcessShard()). Lock-free; shards that have not published yet, or
+   * whose snapshot could not be read within max_attempts, are skipped
+   * (see AggregateState::shards_read).
+   */
+  void Aggregate(AggregateState& out, uint32_t max_attempts = 8U) noexcept {
+    out = AggregateState{};
+    std::array<uint32_t, Shards> recent_count{};
+    for (uint32_t i = 0U; i < Shards; ++i) {
+      typename Shard::StateSnapshot& snap = scratch_[i];
+      if (!shards_[i].Snapshot(snap, max_attempts)) {
+        continue;
+      }
+      ++out.shards_read;
+      recent_count[i] = snap.recent_count;
+      out.active_count += snap.active_count;
+      Accumulate(out.stats, snap.stats);
+      for (uint32_t level = 0U; level < QueueLevels; ++level) {
+        out.queue_depth[level] += snap.queue_depth[level];
+      }
+      if (static_cast<uint8_t>(snap.global_state) > static_cast<uint8_t>(out.global_state)) {
+        out.global_state = snap.global_state;
+      }
+    }
+
+    // k-way merge of the newest-first rings
+    std::array<uint32_t, Shards> pos{};
+    while (out.recent_count < kRecentRingSize) {
+      uint32_t best = Shards;
+      uint64_t best_ts = 0U;
+      for (uint32_t i = 0U; i < Shards; ++i) {
+        if (pos[i] < recent_count[i] && (best == Shards || scratch_[i].recent[pos[i]].timestamp_us > best_ts)) {
+          best = i;
+          best_ts = scratch_[i].recent[pos[i]].timestamp_us;
+        }
+      }
+      if (best == Shards) {
+        break;
+      }
+      out.recent[out.recent_count++] = scratch_[best].recent[pos[best]++];
+    }
+
+    DriveGlobalHsm(out.global_state);
+  }
+
+  /** @brief Aggregate global HSM, advanced by Aggregate() (read from the aggregating thread). */
+  const CompactGlobalHsm& GetGlobalHsm() const noexcept { return global_hsm_; }
+
+ private:
+  static constexpr uint32_t kRouteChunk = 32U;
+
+  struct LaneContext {
+    ShardedFaultCollector* owner = nullptr;
+    uint8_t lane = 0U;
+  };
+
+  static void Accumulate(FaultStatistics& into, const FaultStatistics& s) noexcept {
+    into.total_reported += s.total_reported;
+    into.total_processed += s.total_processed;
+    into.total_dropped += s.total_dropped;
+    into.total_coalesced += s.total_coalesced;
+    into.total_escalated += s.total_escalated;
+    into.total_aged += s.total_aged;
+    into.total_rechecked += s.total_rechecked;
+    for (uint32_t i = 0U; i < FaultStatistics::kMaxLevels; ++i) {
+      into.priority_reported[i] += s.priority_reported[i];
+      into.priority_dropped[i] += s.priority_dropped[i];
+    }
+  }
+
+  /** @brief Walk the aggregate HSM along legal transitions to the merged state. */
+  void DriveGlobalHsm(GlobalState target) noexcept {
+    for (uint32_t step = 0U; step < 3U && global_hsm_.State() != target; ++step) {
+      switch (global_hsm_.State()) {
+        case GlobalState::kIdle:
+          (void)global_hsm_.Dispatch(evt::kFaultReported);
+          break;
+        case GlobalState::kActive:
+          (void)global_hsm_.Dispatch((target == GlobalState::kIdle)       ? evt::kAllCleared
+                                     : (target == GlobalState::kDegraded) ? evt::kCriticalDetected
+                                                                          : evt::kShutdownReq);
+          break;
+        case GlobalState::kDegraded:
+          (void)global_hsm_.Dispatch((target == GlobalState::kShutdown) ? evt::kShutdownReq : evt::kDegradeRecovered);
+          break;
+        case GlobalState::kShutdown:
+          return;  // Terminal
+      }
+    }
+  }
+
+  std::array<Shard, Shards> shards_;
+  std::array<LaneContext, MaxProducers> lane_ctx_{};
+  std::array<typename Shard::StateSnapshot, Shards> scratch_{};  ///< Aggregate() buffers
+  CompactGlobalHsm global_hsm_;
+};
+
+}  // namespace fccu
+
+#endif  // FCCU_FCCU_SHARDED_HPP_
@@ -0,0 +1,415 @@
+/**
+ * @file fccu_shm.hpp
+ * @brief FaultCollector in shared memory: one daemon consumer, client-process producers.
+ *
+ * The whole FaultCollector (queue lanes, active bitmap, statistics) is
+ * placement-constructed in a named POSIX shm region (or any caller-provided
+ * mapping) behind a fixed, versioned ShmHeader. Client processes map the
+ * same region, claim a producer lane and report straight into it; the hot
+ * path is the same wait-free lane push as in-process, with no syscalls.
+ *
+ * Region layout (kShmLayoutVersion 1):
+ *
+ *   offset 0                   ShmHeader (magic, version, layout id, size, state)
+ *   offset kCollectorOffset    FaultCollector<...> (64-byte aligned)
+ *
+ * The layout id hashes the collector's template parameters and sizeof(), so
+ * a client built against a different configuration is refused with
+ * kShmLayoutMismatch instead of corrupting the region.
+ *
+ * Only state that is meaningful in every process may be touched by
+ * clients, so the host fixes HsmDispatchMode::kOnProcess (HSMs run in the
+ * daemon) and OverflowMode::kDeferred (no producer-side callback); do not
+ * change either after Create(). Hooks, bus notifiers and callbacks are
+ * function pointers of the daemon and run on its consumer thread only.
+ * Policy::Notifier must be process-shared (NullNotifier or
+ * SharedFutexNotifier), Policy::Clock must read a system-wide time base
+ * (SteadyClock, CycleCounterClock; not TickClock), and
+ * Policy::kDeferredOverflow must be set (derive from ShmCollectorPolicy).
+ */
+
+#ifndef FCCU_FCCU_SHM_HPP_
+#define FCCU_FCCU_SHM_HPP_
+
+#include "fccu/fccu.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <array>
+#include <atomic>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define FCCU_SHM_POSIX 1
+#endif
+
+namespace fccu {
+
+static constexpr uint32_t kShmMagic = 0x55434346U;  ///< "FCCU" little-endian
+static constexpr uint16_t kShmLayoutVersion = 1U;
+
+enum class ShmState : uint32_t { kInitializing = 0U, kReady = 1U, kClosed = 2U };
+
+/** @brief Fixed region header (64 bytes); fields other than state are written once by the host. */
+struct alignas(64) ShmHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t header_size;
+  uint64_t layout_id;
+  uint64_t region_size;
+  uint64_t collector_offset;
+  std::atomic<uint32_t> state;  ///< ShmState
+  uint32_t owner_pid;
+};
+
+static_assert(sizeof(ShmHeader) == 64U, "ShmHeader layout changed: bump kShmLayoutVersion");
+
+/** @brief Base policy for shared collectors: enables the deferred overflow storage the host relies on. */
+struct ShmCollectorPolicy : DefaultCollectorPolicy {
+  static constexpr bool kDeferredOverflow = true;
+};
+
+namespace detail {
+
+constexpr uint64_t Fnv1aMix(uint64_t hash, uint64_t value) noexcept {
+  for (uint32_t i = 0U; i < 8U; ++i) {
+    hash ^= (value >> (i * 8U)) & 0xFFU;
+    hash *= 0x100000001B3ULL;
+  }
+  return hash;
+}
+
+}  // namespace detail
+
+/** @brief Compile-time region geometry for one FaultCollector instantiation. */
+template <typename Collector>
+struct ShmLayout {
+  static constexpr uint64_t ComputeLayoutId() noexcept {
+    const std::array<uint64_t, 8> fields = {kShmLayoutVersion,       sizeof(Collector),
+                                            alignof(Collector),      Collector::kMaxFaults,
+                                            Collector::kQueueDepth,  Collector::kQueueLevels,
+                                            Collector::kMaxProducers, sizeof(typename Collector::QueueEntry)};
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (uint64_t v : fields) {
+      hash = detail::Fnv1aMix(hash, v);
+    }
+    return hash;
+  }
+
+  static constexpr uint64_t kCollectorOffset =
+      (sizeof(ShmHeader) + alignof(Collector) - 1U) / alignof(Collector) * alignof(Collector);
+  static constexpr uint64_t kRegionSize = kCollectorOffset + sizeof(Collector);
+  static constexpr uint64_t kLayoutId = ComputeLayoutId();
+
+  static_assert(alignof(Collector) <= 4096U, "Collector alignment exceeds a page");
+  static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free &&
+                    std::atomic<bool>::is_always_lock_free,
+                "shared-memory atomics must be lock-free");
+  static_assert(Collector::kDeferredOverflow,
+                "the host fixes OverflowMode::kDeferred: derive the policy from ShmCollectorPolicy");
+  static_assert(Collector::Notifier::kProcessShared, "Policy::Notifier must be process-shared (SharedFutexNotifier)");
+};
+
+// ============================================================================
+// ShmFaultCollectorHost - daemon side: creates the region, runs ProcessFaults
+// ============================================================================
+
+/**
+ * @brief Owns the shared region and the FaultCollector inside it.
+ *
+ * Create(), configure the collector (RegisterFault, hooks, callbacks),
+ * then Publish() to let clients attach. Close() (or the destructor) marks
+ * the region closed, destroys the collector and unlinks the name.
+ */
+template <typename Collector>
+class ShmFaultCollectorHost {
+ public:
+  using Layout = ShmLayout<Collector>;
+
+  ShmFaultCollectorHost() noexcept = default;
+  ~ShmFaultCollectorHost() { Close(); }
+  ShmFaultCollectorHost(const ShmFaultCollectorHost&) = delete;
+  ShmFaultCollectorHost& operator=(const ShmFaultCollectorHost&) = delete;
+
+#if defined(FCCU_SHM_POSIX)
+  /**
+   * @brief Create (replacing a stale region of the same name) and construct the collector.
+   *
+   * An existing region is only replaced when it is closed or its owner_pid
+   * no longer exists (crashed daemon); a region of a live host, or one
+   * without a valid header, is left alone and kShmUnavailable returned.
+   * @param name POSIX shm name, e.g. "/fccu"
+   */
+  FccuError Create(const char* name) noexcept {
+    if (base_ != nullptr || name == nullptr || std::strlen(name) >= sizeof(name_)) {
+      return FccuError::kShmUnavailable;
+    }
+    if (!ReclaimStaleRegion(name)) {
+      return FccuError::kShmUnavailable;
+    }
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0660);
+    if (fd < 0) {
+      return FccuError::kShmUnavailable;
+    }
+    void* mem = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(Layout::kRegionSize)) == 0) {
+      mem = mmap(nullptr, Layout::kRegionSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    (void)close(fd);
+    if (mem == MAP_FAILED) {
+      (void)shm_unlink(name);
+      return FccuError::kShmUnavailable;
+    }
+    mapped_ = true;
+    std::memcpy(name_, name, std::strlen(name) + 1U);
+    return Construct(mem);
+  }
+#endif
+
+  /** @brief Construct into caller-provided shared memory (at least Layout::kRegionSize, page aligned). */
+  FccuError CreateIn(void* base, uint64_t size) noexcept {
+    if (base_ != nullptr || base == nullptr || size < Layout::kRegionSize) {
+      return FccuError::kShmUnavailable;
+    }
+    return Construct(base);
+  }
+
+  /** @brief Allow clients to attach (call after configuring the collector). */
+  void Publish() noexcept {
+    if (base_ != nullptr) {
+      Header()->state.store(static_cast<uint32_t>(ShmState::kReady), std::memory_order_release);
+    }
+  }
+
+  void Close() noexcept {
+    if (base_ == nullptr) {
+      return;
+    }
+    Header()->state.store(static_cast<uint32_t>(ShmState::kClosed), std::memory_order_release);
+    collector_->~Collector();
+#if defined(FCCU_SHM_POSIX)
+    if (mapped_) {
+      (void)munmap(base_, Layout::kRegionSize);
+      (void)shm_unlink(name_);
+    }
+#endif
+    base_ = nullptr;
+    collector_ = nullptr;
+    mapped_ = false;
+  }
+
+  /** @brief The shared collector (nullptr before Create()); the daemon calls ProcessFaults() on it. */
+  Collector* Get() noexcept { return collector_; }
+
+ private:
+  ShmHeader* Header() noexcept { return static_cast<ShmHeader*>(base_); }
+
+#if defined(FCCU_SHM_POSIX)
+  /** @return true if name is free (absent, or a stale region that was unlinked) */
+  static bool ReclaimStaleRegion(const char* name) noexcept {
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) {
+      return errno == ENOENT;
+    }
+    struct stat st {};
+    void* mem = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && static_cast<uint64_t>(st.st_size) >= sizeof(ShmHeader)) {
+      mem = mmap(nullptr, sizeof(ShmHeader), PROT_READ, MAP_SHARED, fd, 0);
+    }
+    (void)close(fd);
+    if (mem == MAP_FAILED) {
+      return false;
+    }
+    const auto* header = static_cast<const ShmHeader*>(mem);
+    const bool closed = header->state.load(std::memory_order_acquire) == static_cast<uint32_t>(ShmState::kClosed);
+    const bool owner_gone = kill(static_cast<pid_t>(header->owner_pid), 0) != 0 && errno == ESRCH;
+    const bool stale = header->magic == kShmMagic && header->owner_pid != 0U && (closed || owner_gone);
+    (void)munmap(mem, sizeof(ShmHeader));
+    return stale && shm_unlink(name) == 0;
+  }
+#endif
+
+  FccuError Construct(void* base) noexcept {
+    base_ = base;
+    auto* header = new (base) ShmHeader{};
+    header->state.store(static_cast<uint32_t>(ShmState::kInitializing), std::memory_order_relaxed);
+    header->magic = kShmMagic;
+    header->version = kShmLayoutVersion;
+    header->header_size = static_cast<uint16_t>(sizeof(ShmHeader));
+    header->layout_id = Layout::kLayoutId;
+    header->region_size = Layout::kRegionSize;
+    header->collector_offset = Layout::kCollectorOffset;
+#if defined(FCCU_SHM_POSIX)
+    header->owner_pid = static_cast<uint32_t>(getpid());
+#endif
+    collector_ = new (static_cast<uint8_t*>(base) + Layout::kCollectorOffset) Collector();
+    collector_->SetHsmDispatchMode(HsmDispatchMode::kOnProcess);
+    collector_->SetOverflowMode(OverflowMode::kDeferred);
+    return FccuError::kOk;
+  }
+
+  void* base_ = nullptr;
+  Collector* collector_ = nullptr;
+  char name_[256] = {};  ///< Copy for shm_unlink() in Close()
+  bool mapped_ = false;
+};
+
+// ============================================================================
+// ShmFaultClient - producer process: attaches, owns one lane, reports
+// ============================================================================
+
+/**
+ * @brief Producer-side view of a published region.
+ *
+ * Open() validates the header and claims a producer lane; Close() (or the
+ * destructor) returns it. Reports go straight into the shared queues.
+ * Only the producer API is exposed; the collector is driven by the daemon.
+ */
+template <typename Collector>
+class ShmFaultClient {
+ public:
+  using Layout = ShmLayout<Collector>;
+
+  ShmFaultClient() noexcept = default;
+  ~ShmFaultClient() { Close(); }
+  ShmFaultClient(const ShmFaultClient&) = delete;
+  ShmFaultClient& operator=(const ShmFaultClient&) = delete;
+
+#if defined(FCCU_SHM_POSIX)
+  FccuError Open(const char* name) noexcept {
+    if (base_ != nullptr || name == nullptr) {
+      return FccuError::kShmUnavailable;
+    }
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0) {
+      return FccuError::kShmUnavailable;
+    }
+    struct stat st {};
+    void* mem = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && static_cast<uint64_t>(st.st_size) >= Layout::kRegionSize) {
+      mem = mmap(nullptr, Layout::kRegionSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    (void)close(fd);
+    if (mem == MAP_FAILED) {
+      return FccuError::kShmUnavailable;
+    }
+    mapped_ = true;
+    FccuError err = Attach(mem, Layout::kRegionSize);
+    if (err != FccuError::kOk) {
+      (void)munmap(mem, Layout::kRegionSize);
+      mapped_ = false;
+    }
+    return err;
+  }
+#endif
+
+  /** @brief Attach to a caller-provided mapping of a host region. */
+  FccuError OpenIn(void* base, uint64_t size) noexcept {
+    if (base_ != nullptr || base == nullptr) {
+      return FccuError::kShmUnavailable;
+    }
+    return Attach(base, size);
+  }
+
+  void Close() noexcept {
+    if (base_ == nullptr) {
+      return;
+    }
+    if (IsAttached()) {
+      collector_->ReleaseProducer(lane_);
+    }
+#if defined(FCCU_SHM_POSIX)
+    if (mapped_) {
+      (void)munmap(base_, Layout::kRegionSize);
+    }
+#endif
+    base_ = nullptr;
+    collector_ = nullptr;
+    mapped_ = false;
+  }
+
+  /** @brief Host still serving the region. */
+  bool IsAttached() const noexcept {
+    return base_ != nullptr &&
+           Header()->state.load(std::memory_order_acquire) == static_cast<uint32_t>(ShmState::kReady);
+  }
+
+  uint8_t Lane() const noexcept { return lane_; }
+
+  FccuError ReportFault(FaultIndex fault_index, uint32_t detail = 0U,
+                        FaultPriority priority = FaultPriority::kMedium) noexcept {
+    if (!IsAttached()) {
+      return FccuError::kShmNotReady;
+    }
+    return collector_->ReportFaultFrom(lane_, fault_index, detail, priority);
+  }
+
+  FaultBatchResult ReportFaults(const FaultReport* reports, uint32_t count, FccuError* out_errors = nullptr) noexcept {
+    if (!IsAttached()) {
+      FaultBatchResult result{};
+      result.rejected = count;
+      return result;
+    }
+    return collector_->ReportFaultsFrom(lane_, reports, count, out_errors);
+  }
+
+  bool IsFaultActive(FaultIndex fault_index) const noexcept {
+    return IsAttached() && collector_->IsFaultActive(fault_index);
+  }
+
+  /** @brief FaultReporter bound to this client (process-local context). */
+  FaultReporter GetReporter() noexcept {
+    FaultReporter reporter{};
+    reporter.fn = [](FaultIndex fi, uint32_t det, FaultPriority pri, void* ctx) {
+      static_cast<ShmFaultClient*>(ctx)->ReportFault(fi, det, pri);
+    };
+    reporter.ctx = this;
+    return reporter;
+  }
+
+ private:
+  const ShmHeader* Header() const noexcept { return static_cast<const ShmHeader*>(base_); }
+
+  FccuError Attach(void* base, uint64_t size) noexcept {
+    const auto* header = static_cast<const ShmHeader*>(base);
+    if (size < sizeof(ShmHeader)) {
+      return FccuError::kShmUnavailable;
+    }
+    if (header->state.load(std::memory_order_acquire) != static_cast<uint32_t>(ShmState::kReady)) {
+      return FccuError::kShmNotReady;
+    }
+    if (header->magic != kShmMagic || header->version != kShmLayoutVersion ||
+        header->header_size != sizeof(ShmHeader) || header->layout_id != Layout::kLayoutId ||
+        header->region_size != Layout::kRegionSize || header->collector_offset != Layout::kCollectorOffset ||
+        size < Layout::kRegionSize) {
+      return FccuError::kShmLayoutMismatch;
+    }
+    auto* collector =
+        std::launder(reinterpret_cast<Collector*>(static_cast<uint8_t*>(base) + Layout::kCollectorOffset));
+    FccuError err = collector->RegisterProducer(lane_);
+    if (err != FccuError::kOk) {
+      return err;
+    }
+    base_ = base;
+    collector_ = collector;
+    return FccuError::kOk;
+  }
+
+  void* base_ = nullptr;
+  Collector* collector_ = nullptr;
+  uint8_t lane_ = 0U;
+  bool mapped_ = false;
+};
+
+}  // namespace fccu
+
+#endif  // FCCU_FCCU_SHM_HPP_
@@ -0,0 +1,159 @@
+/**
+ * @file latency_histogram.hpp
+ * @brief Lock-free log2-bucket latency histogram (single writer, any reader).
+ *
+ * Bucket 0 holds the value 0; bucket i (i >= 1) holds values in
+ * [2^(i-1), 2^i). The last bucket saturates. Record() is a handful of
+ * relaxed load/store pairs with no RMW, so it must only be called by one
+ * thread (the FaultCollector consumer). Readers on other threads see
+ * relaxed, possibly slightly torn-between-fields, but never corrupt values.
+ */
+
+#ifndef FCCU_LATENCY_HISTOGRAM_HPP_
+#define FCCU_LATENCY_HISTOGRAM_HPP_
+
+#include <cstdint>
+
+#include <array>
+#include <atomic>
+
+namespace fccu {
+
+namespace detail {
+
+/** @brief Number of significant bits in x (0 for x == 0). */
+inline uint32_t BitWidth64(uint64_t x) noexcept {
+  if (x == 0U) {
+    return 0U;
+  }
+#if defined(__GNUC__) || defined(__clang__)
+  return 64U - static_cast<uint32_t>(__builtin_clzll(x));
+#else
+  uint32_t n = 0U;
+  while (x != 0U) {
+    x >>= 1U;
+    ++n;
+  }
+  return n;
+#endif
+}
+
+}  // namespace detail
+
+/**
+ * @brief Log2 histogram of unsigned samples (nanoseconds in FaultCollector).
+ *
+ * @tparam Buckets Bucket count (2..65, default: 40, saturates at ~9 minutes in ns)
+ */
+template <uint32_t Buckets = 40U>
+class LatencyHistogram {
+  static_assert(Buckets >= 2U && Buckets <= 65U, "Buckets must be 2..65");
+
+ public:
+  static constexpr uint32_t kBuckets = Buckets;
+
+  /** @brief Add one sample (single writer). */
+  void Record(uint64_t value) noexcept {
+    uint32_t b = detail::BitWidth64(value);
+    if (b >= Buckets) {
+      b = Buckets - 1U;
+    }
+    Bump(buckets_[b]);
+    Bump(count_);
+    if (value < min_.load(std::memory_order_relaxed)) {
+      min_.store(value, std::memory_order_relaxed);
+    }
+    if (value > max_.load(std::memory_order_relaxed)) {
+      max_.store(value, std::memory_order_relaxed);
+    }
+  }
+
+  /** @brief Clear all samples (single writer, or while the writer is quiescent). */
+  void Reset() noexcept {
+    for (auto& b : buckets_) {
+      b.store(0U, std::memory_order_relaxed);
+    }
+    count_.store(0U, std::memory_order_relaxed);
+    min_.store(UINT64_MAX, std::memory_order_relaxed);
+    max_.store(0U, std::memory_order_relaxed);
+  }
+
+  uint64_t Count() const noexcept { return count_.load(std::memory_order_relaxed); }
+
+  /** @brief Smallest sample, 0 when empty. */
+  uint64_t Min() const noexcept {
+    uint64_t v = min_.load(std::memory_order_relaxed);
+    return (v == UINT64_MAX) ? 0U : v;
+  }
+
+  uint64_t Max() const noexcept { return max_.load(std::memory_order_relaxed); }
+
+  uint64_t BucketCount(uint32_t bucket) const noexcept {
+    return (bucket < Buckets) ? buckets_[bucket].load(std::memory_order_relaxed) : 0U;
+  }
+
+  /** @brief Inclusive upper bound of a bucket's value range. */
+  static constexpr uint64_t BucketUpperBound(uint32_t bucket) noexcept {
+    return (bucket == 0U) ? 0U : (bucket >= 64U) ? UINT64_MAX : ((1ULL << bucket) - 1U);
+  }
+
+  /**
+   * @brief Value at the given quantile, in parts per thousand.
+   *
+   * Returns the upper bound of the bucket holding that rank, capped at Max(),
+   * i.e. a conservative estimate (never below the true quantile by more than
+   * the bucket width). 0 when empty.
+   *
+   * @param permille 1..1000 (500 = p50, 990 = p99)
+   */
+  uint64_t ValueAtPermille(uint32_t permille) const noexcept {
+    return ValueAtRank(permille, 1000U);
+  }
+
+  uint64_t P50() const noexcept { return ValueAtRank(500U, 1000U); }
+  uint64_t P99() const noexcept { return ValueAtRank(990U, 1000U); }
+  uint64_t P999() const noexcept { return ValueAtRank(9990U, 10000U); }
+
+ private:
+  static void Bump(std::atomic<uint64_t>& counter) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+  }
+
+  uint64_t ValueAtRank(uint64_t num, uint64_t den) const noexcept {
+    uint64_t total = 0U;
+    std::array<uint64_t, Buckets> snap{};
+    for (uint32_t i = 0U; i < Buckets; ++i) {
+      snap[i] = buckets_[i].load(std::memory_order_relaxed);
+      total += snap[i];
+    }
+    if (total == 0U) {
+      return 0U;
+    }
+    if (num > den) {
+      num = den;
+    }
+    uint64_t rank = (total / den) * num + ((total % den) * num + den - 1U) / den;  // ceil(total * q)
+    if (rank == 0U) {
+      rank = 1U;
+    }
+    uint64_t seen = 0U;
+    const uint64_t max = Max();
+    for (uint32_t i = 0U; i < Buckets; ++i) {
+      seen += snap[i];
+      if (seen >= rank) {
+        uint64_t upper = (i == Buckets - 1U) ? UINT64_MAX : BucketUpperBound(i);
+        return (upper < max) ? upper : max;
+      }
+    }
+    return max;
+  }
+
+  std::array<std::atomic<uint64_t>, Buckets> buckets_{};
+  std::atomic<uint64_t> count_{0U};
+  std::atomic<uint64_t> min_{UINT64_MAX};
+  std::atomic<uint64_t> max_{0U};
+};
+
+}  // namespace fccu
+
+#endif  // FCCU_LATENCY_HISTOGRAM_HPP_
@@ -0,0 +1,88 @@
+/**
+ * @file seqlock.hpp
+ * @brief Single-writer sequence lock over a trivially copyable value.
+ *
+ * The writer never waits: Store() bumps the sequence to odd, copies the
+ * value into atomic words and bumps it to even again. Readers copy
+ * the words and keep the copy only if the sequence was even and unchanged,
+ * so a reader can never delay the writer and never sees a torn value.
+ * The payload is held in std::atomic words rather than plain memory, so the
+ * concurrent copy is well defined; per-word release stores / acquire loads
+ * order it against the sequence without standalone fences (plain moves on
+ * x86, and understood by ThreadSanitizer).
+ */
+
+#ifndef FCCU_SEQLOCK_HPP_
+#define FCCU_SEQLOCK_HPP_
+
+#include <cstdint>
+#include <cstring>
+
+#include <array>
+#include <atomic>
+#include <type_traits>
+
+namespace fccu {
+
+template <typename T>
+class SeqLock {
+  static_assert(std::is_trivially_copyable<T>::value, "SeqLock payload must be trivially copyable");
+
+ public:
+  static constexpr uint32_t kWords = static_cast<uint32_t>((sizeof(T) + 7U) / 8U);
+
+  /** @brief Publish a new value (single writer thread only). */
+  void Store(const T& value) noexcept {
+    const uint64_t seq = seq_.load(std::memory_order_relaxed);
+    seq_.store(seq + 1U, std::memory_order_relaxed);
+    const auto* src = reinterpret_cast<const uint8_t*>(&value);
+    for (uint32_t i = 0U; i < kWords; ++i) {
+      uint64_t word = 0U;
+      std::memcpy(&word, src + i * 8U, ChunkSize(i));
+      words_[i].store(word, std::memory_order_release);  // Ordered after the odd sequence
+    }
+    seq_.store(seq + 2U, std::memory_order_release);
+  }
+
+  /**
+   * @brief One read attempt; never blocks.
+   * @return false if nothing was published yet or a Store() overlapped the copy
+   */
+  bool TryLoad(T& out) const noexcept {
+    const uint64_t before = seq_.load(std::memory_order_acquire);
+    if (before == 0U || (before & 1U) != 0U) {
+      return false;
+    }
+    auto* dst = reinterpret_cast<uint8_t*>(&out);
+    for (uint32_t i = 0U; i < kWords; ++i) {
+      const uint64_t word = words_[i].load(std::memory_order_acquire);  // Keeps the re-check below last
+      std::memcpy(dst + i * 8U, &word, ChunkSize(i));
+    }
+    return seq_.load(std::memory_order_relaxed) == before;
+  }
+
+  /** @brief TryLoad() up to max_attempts times; out is unspecified when false is returned. */
+  bool Load(T& out, uint32_t max_attempts = 8U) const noexcept {
+    for (uint32_t i = 0U; i < max_attempts; ++i) {
+      if (TryLoad(out)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /** @brief Number of completed Store() calls. */
+  uint64_t Version() const noexcept { return seq_.load(std::memory_order_acquire) / 2U; }
+
+ private:
+  static constexpr size_t ChunkSize(uint32_t word) noexcept {
+    return (word + 1U < kWords || sizeof(T) % 8U == 0U) ? 8U : sizeof(T) % 8U;
+  }
+
+  alignas(64) std::atomic<uint64_t> seq_{0U};
+  std::array<std::atomic<uint64_t>, kWords> words_{};
+};
+
+}  // namespace fccu
+
+#endif  // FCCU_SEQLOCK_HPP_
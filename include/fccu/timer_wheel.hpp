@@ -0,0 +1,151 @@
+/**
+ * @file timer_wheel.hpp
+ * @brief Hashed timer wheel with at most one timer per id, no allocation.
+ *
+ * A timer expiring at tick T lives in slot T % Slots on an intrusive
+ * doubly linked list threaded through per-id arrays, so Schedule() and
+ * Cancel() are O(1) and Advance() only walks the slots of the ticks that
+ * passed (at most one full lap). Timers further out than one lap stay in
+ * their slot and are skipped by a single compare until their lap comes.
+ * Single-threaded: all calls from the owning (consumer) thread.
+ */
+
+#ifndef FCCU_TIMER_WHEEL_HPP_
+#define FCCU_TIMER_WHEEL_HPP_
+
+#include <cstdint>
+
+#include <array>
+
+namespace fccu {
+
+/**
+ * @tparam Slots    Wheel slots (power of 2)
+ * @tparam Capacity Number of timer ids (0..Capacity-1, Capacity <= 65535)
+ */
+template <uint32_t Slots, uint32_t Capacity>
+class TimerWheel {
+  static_assert(Slots >= 1U && (Slots & (Slots - 1U)) == 0U, "TimerWheel Slots must be a power of 2");
+  static_assert(Capacity >= 1U && Capacity <= 0xFFFFU, "TimerWheel ids are 16-bit");
+
+ public:
+  static constexpr uint32_t kSlots = Slots;
+
+  /**
+   * @brief Arm id to expire at tick expiry, replacing a timer it already has.
+   *
+   * An expiry not after Now() is moved to the next tick.
+   */
+  void Schedule(uint16_t id, uint64_t expiry) noexcept {
+    if (id >= Capacity) {
+      return;
+    }
+    (void)Cancel(id);
+    if (expiry <= now_) {
+      expiry = now_ + 1U;
+    }
+    const uint32_t slot = SlotOf(expiry);
+    expiry_[id] = expiry;
+    prev_[id] = 0U;
+    next_[id] = head_[slot];
+    if (head_[slot] != 0U) {
+      prev_[head_[slot] - 1U] = static_cast<uint16_t>(id + 1U);
+    }
+    head_[slot] = static_cast<uint16_t>(id + 1U);
+    ++pending_;
+  }
+
+  /** @brief Disarm id; false if it had no timer. Safe from inside an Advance() callback. */
+  bool Cancel(uint16_t id) noexcept {
+    if (!IsScheduled(id)) {
+      return false;
+    }
+    if (cursor_ == id + 1U) {
+      cursor_ = next_[id];
+    }
+    if (prev_[id] != 0U) {
+      next_[prev_[id] - 1U] = next_[id];
+    } else {
+      head_[SlotOf(expiry_[id])] = next_[id];
+    }
+    if (next_[id] != 0U) {
+      prev_[next_[id] - 1U] = prev_[id];
+    }
+    expiry_[id] = 0U;
+    --pending_;
+    return true;
+  }
+
+  /** @brief Disarm every timer. */
+  void Clear() noexcept {
+    for (uint32_t slot = 0U; slot < Slots && pending_ != 0U; ++slot) {
+      while (head_[slot] != 0U) {
+        (void)Cancel(static_cast<uint16_t>(head_[slot] - 1U));
+      }
+    }
+  }
+
+  /**
+   * @brief Move the wheel to tick now and call fire(id) for every timer expiring by then.
+   *
+   * Expired timers are disarmed before their callback, which may Schedule()
+   * or Cancel() any id; a timer scheduled from a callback fires on a later
+   * Advance() at the earliest.
+   * @return Number of timers fired
+   */
+  template <typename Fn>
+  uint32_t Advance(uint64_t now, Fn&& fire) noexcept {
+    if (now <= now_) {
+      return 0U;
+    }
+    const uint64_t from = now_;
+    now_ = now;
+    if (pending_ == 0U) {
+      return 0U;
+    }
+    const uint64_t ticks = (now - from < Slots) ? (now - from) : Slots;
+    uint32_t fired = 0U;
+    for (uint64_t t = 1U; t <= ticks; ++t) {
+      uint16_t link = head_[SlotOf(from + t)];
+      while (link != 0U) {
+        const auto id = static_cast<uint16_t>(link - 1U);
+        cursor_ = next_[id];
+        if (expiry_[id] <= now) {
+          (void)Cancel(id);
+          ++fired;
+          fire(id);
+        }
+        link = cursor_;
+      }
+    }
+    cursor_ = 0U;
+    return fired;
+  }
+
+  bool IsScheduled(uint16_t id) const noexcept { return id < Capacity && expiry_[id] != 0U; }
+
+  /** @brief Expiry tick of id (0 when not scheduled). */
+  uint64_t Expiry(uint16_t id) const noexcept { return (id < Capacity) ? expiry_[id] : 0U; }
+
+  /** @brief Number of armed timers. */
+  uint32_t Pending() const noexcept { return pending_; }
+
+  /** @brief Tick of the last Advance(). */
+  uint64_t Now() const noexcept { return now_; }
+
+ private:
+  static constexpr uint32_t SlotOf(uint64_t tick) noexcept { return static_cast<uint32_t>(tick & (Slots - 1U)); }
+
+  // Links hold id + 1 (0 = none), so zero-initialized storage is an empty wheel
+  std::array<uint16_t, Slots> head_{};
+  std::array<uint16_t, Capacity> next_{};
+  std::array<uint16_t, Capacity> prev_{};
+  std::array<uint64_t, Capacity> expiry_{};  ///< 0 = not scheduled (expiries are always > 0)
+  uint64_t now_ = 0U;
+  uint32_t pending_ = 0U;
+  uint16_t cursor_ = 0U;  ///< Next link of the list Advance() is walking, kept valid by Cancel()
+};
+
+}  // namespace fccu
+
+#endif  // FCCU_TIMER_WHEEL_HPP_
@@ -4,9 +4,29 @@
  */
 
 #include "fccu/fccu.hpp"
+#include "fccu/fccu_hierarchy.hpp"
+#include "fccu/fccu_mccc_bridge.hpp"
+#include "fccu/fccu_notifier.hpp"
+#include "fccu/fccu_sharded.hpp"
+#include "fccu/fccu_shm.hpp"
+#include "fccu/fault_recorder.hpp"
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <cstring>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 // ============================================================================
 // Test Helpers
 // ============================================================================
@@ -106,6 +126,105 @@ TEST_CASE("Multiple faults at different priorities", "[report]") {
   REQUIRE(c.ActiveFaultCount() == 0U);
 }
 
+TEST_CASE("ReportFaults batch admits, drops and rejects", "[report][batch]") {
+  TestCollector c;  // QueueDepth = 8
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterFault(1U, 0x1002U);
+  c.RegisterHook(0U, HandledHook);
+  c.RegisterHook(1U, HandledHook);
+
+  fccu::FaultReport reports[10];
+  for (uint32_t i = 0U; i < 6U; ++i) {
+    reports[i].fault_index = 1U;
+    reports[i].detail = i;
+    reports[i].priority = fccu::FaultPriority::kLow;  // 60% of 8 -> 4 admitted
+  }
+  reports[6].fault_index = 0U;
+  reports[6].priority = fccu::FaultPriority::kCritical;
+  reports[7].fault_index = 0U;
+  reports[7].priority = fccu::FaultPriority::kHigh;
+  reports[8].fault_index = 5U;  // not registered
+  reports[9].fault_index = 99U;  // out of range
+
+  fccu::FccuError errors[10];
+  auto result = c.ReportFaults(reports, 10U, errors);
+  REQUIRE(result.admitted == 6U);
+  REQUIRE(result.dropped == 2U);
+  REQUIRE(result.rejected == 2U);
+  REQUIRE(errors[3] == fccu::FccuError::kOk);
+  REQUIRE(errors[4] == fccu::FccuError::kQueueFull);
+  REQUIRE(errors[5] == fccu::FccuError::kQueueFull);
+  REQUIRE(errors[6] == fccu::FccuError::kOk);
+  REQUIRE(errors[8] == fccu::FccuError::kNotRegistered);
+  REQUIRE(errors[9] == fccu::FccuError::kInvalidIndex);
+
+  auto stats = c.GetStatistics();
+  REQUIRE(stats.total_reported == 6U);
+  REQUIRE(stats.total_dropped == 2U);
+  REQUIRE(stats.priority_reported[3] == 4U);
+  REQUIRE(stats.priority_dropped[3] == 2U);
+  REQUIRE(c.GetGlobalHsm().IsDegraded());
+
+  REQUIRE(c.ProcessFaults() == 6U);
+}
+
+TEST_CASE("ReportFaults larger than one chunk keeps order", "[report][batch]") {
+  fccu::FaultCollector<4, 128, 4, 1> c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterHook(0U, DeferHook);
+
+  fccu::FaultReport reports[70];
+  for (uint32_t i = 0U; i < 70U; ++i) {
+    reports[i].fault_index = 0U;
+    reports[i].detail = i;
+    reports[i].priority = fccu::FaultPriority::kCritical;
+  }
+  auto result = c.ReportFaults(reports, 70U);
+  REQUIRE(result.admitted == 70U);
+
+  static uint32_t expected = 0U;
+  static bool in_order = true;
+  expected = 0U;
+  in_order = true;
+  c.RegisterHook(0U, [](const fccu::FaultEvent& e, void* /*ctx*/) -> fccu::HookAction {
+    in_order = in_order && (e.detail == expected++);
+    return fccu::HookAction::kDefer;
+  });
+  REQUIRE(c.ProcessFaults() == 70U);
+  REQUIRE(in_order);
+}
+
+TEST_CASE("ProcessFaults item budget", "[process]") {
+  fccu::FaultCollector<4, 64, 4, 1> c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterHook(0U, HandledHook);
+  for (uint32_t i = 0U; i < 40U; ++i) {
+    c.ReportFault(0U, i, fccu::FaultPriority::kCritical);
+  }
+
+  REQUIRE(c.ProcessFaults(10U) == 10U);
+  REQUIRE(c.ProcessFaults(25U) == 25U);
+  REQUIRE(c.ProcessFaults() == 5U);
+  REQUIRE(c.ProcessFaults() == 0U);
+}
+
+TEST_CASE("ProcessFaults time budget stops between blocks", "[process]") {
+  fccu::FaultCollector<4, 64, 4, 1> c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterHook(0U, [](const fccu::FaultEvent& /*e*/, void* /*ctx*/) -> fccu::HookAction {
+    auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(20);
+    while (std::chrono::steady_clock::now() < until) {
+    }
+    return fccu::HookAction::kHandled;
+  });
+  for (uint32_t i = 0U; i < 40U; ++i) {
+    c.ReportFault(0U, i, fccu::FaultPriority::kCritical);
+  }
+
+  REQUIRE(c.ProcessFaults(0U, 1U) == TestCollector::kDrainBlock);
+  REQUIRE(c.ProcessFaults() == 40U - TestCollector::kDrainBlock);
+}
+
 // ============================================================================
 // HookAction Tests
 // ============================================================================
@@ -128,25 +247,45 @@ TEST_CASE("HookAction::kDefer keeps fault active", "[hook]") {
   REQUIRE(c.IsFaultActive(0U));
 }
 
-TEST_CASE("HookAction::kEscalate re-enqueues at higher priority", "[hook]") {
+TEST_CASE("HookAction::kEscalate re-runs the hook at once at higher priority", "[hook]") {
   TestCollector c;
   c.RegisterFault(0U, 0x1001U);
 
   // First call escalates, subsequent call handles
   static int call_count = 0;
+  static fccu::FaultPriority seen[2];
+  static uint64_t stamps[2];
   call_count = 0;
-  c.RegisterHook(0U, [](const fccu::FaultEvent& /*e*/, void* /*ctx*/) -> fccu::HookAction {
+  c.RegisterHook(0U, [](const fccu::FaultEvent& e, void* /*ctx*/) -> fccu::HookAction {
+    seen[call_count] = e.priority;
+    stamps[call_count] = e.timestamp_us;
     ++call_count;
     return (call_count == 1) ? fccu::HookAction::kEscalate : fccu::HookAction::kHandled;
   });
 
   c.ReportFault(0U, 0U, fccu::FaultPriority::kMedium);
-  c.ProcessFaults();
-  // After escalation, the fault is re-enqueued at kHigh
-  // Second ProcessFaults processes the escalated entry
-  c.ProcessFaults();
+  // Escalation happens within the same ProcessFaults(), without a queue round trip
+  REQUIRE(c.ProcessFaults() == 1U);
   REQUIRE(call_count == 2);
+  REQUIRE(seen[0] == fccu::FaultPriority::kMedium);
+  REQUIRE(seen[1] == fccu::FaultPriority::kHigh);
+  REQUIRE(stamps[1] == stamps[0]);  // Original timestamp kept
   REQUIRE_FALSE(c.IsFaultActive(0U));
+  REQUIRE(c.GetStatistics().total_escalated == 1U);
+  REQUIRE(c.ProcessFaults() == 0U);
+}
+
+TEST_CASE("HookAction::kEscalate stops at kCritical and leaves the fault active", "[hook]") {
+  TestCollector c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterHook(0U, EscalateHook);
+
+  c.ReportFault(0U, 0U, fccu::FaultPriority::kLow);
+  REQUIRE(c.ProcessFaults() == 1U);
+  REQUIRE(c.GetStatistics().total_escalated == 3U);  // Low -> Medium -> High -> Critical
+  REQUIRE(c.GetStatistics().total_processed == 1U);
+  REQUIRE(c.IsFaultActive(0U));
+  REQUIRE(c.GetGlobalHsm().IsDegraded());
 }
 
 TEST_CASE("HookAction::kShutdown sets shutdown flag", "[hook]") {
@@ -218,6 +357,86 @@ TEST_CASE("Critical priority always admitted", "[admission]") {
   REQUIRE((result == fccu::FccuError::kOk || result == fccu::FccuError::kQueueFull));
 }
 
+struct HalfFullAdmission {
+  static constexpr uint32_t FillLimitPercent(uint32_t level, bool throttled) noexcept {
+    return (level == 0U) ? 100U : (throttled ? 25U : 50U);
+  }
+};
+
+TEST_CASE("FaultQueueSet uses a custom admission policy", "[admission]") {
+  using Qs = fccu::FaultQueueSet<fccu::FaultEntry, 4, 8, 1, HalfFullAdmission>;
+  static_assert(Qs::kAdmitLimit[0] == 8U, "critical limit");
+  static_assert(Qs::kAdmitLimit[3] == 4U, "50% of 8");
+  static_assert(Qs::kThrottledAdmitLimit[1] == 2U, "25% of 8");
+
+  Qs qs;
+  fccu::FaultEntry entry{};
+  uint32_t admitted = 0U;
+  while (qs.PushWithAdmission(1U, entry)) {
+    ++admitted;
+  }
+  REQUIRE(admitted == 4U);
+
+  qs.SetThrottled(true);
+  REQUIRE(qs.IsThrottled());
+  REQUIRE(qs.AdmitLimit(1U) == 2U);
+  REQUIRE_FALSE(qs.PushWithAdmission(1U, entry));
+  REQUIRE(qs.PushBatchWithAdmission(0U, 2U, &entry, 1U) == 1U);
+  REQUIRE(qs.PushWithAdmission(0U, entry));
+}
+
+TEST_CASE("Degraded state throttles medium and low admission", "[admission]") {
+  // QueueDepth=8: Medium admits below 6 normally, below 3 while throttled
+  TestCollector c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterFault(1U, 0x1002U);
+  c.RegisterHook(0U, DeferHook);
+  c.RegisterHook(1U, HandledHook);
+  c.SetDegradedThrottling(true);
+  REQUIRE_FALSE(c.IsAdmissionThrottled());
+
+  c.ReportFault(0U, 0U, fccu::FaultPriority::kCritical);
+  REQUIRE(c.GetGlobalHsm().IsDegraded());
+  REQUIRE(c.IsAdmissionThrottled());
+
+  uint32_t admitted = 0U;
+  for (uint32_t i = 0U; i < 6U; ++i) {
+    if (c.ReportFault(1U, i, fccu::FaultPriority::kMedium) == fccu::FccuError::kOk) {
+      ++admitted;
+    }
+  }
+  REQUIRE(admitted == 3U);
+  REQUIRE(c.ReportFault(0U, 0U, fccu::FaultPriority::kCritical) == fccu::FccuError::kOk);
+
+  // Fault 0 is deferred, so the FCCU stays Degraded after processing
+  c.ProcessFaults();
+  REQUIRE(c.GetGlobalHsm().IsDegraded());
+  REQUIRE(c.IsAdmissionThrottled());
+
+  // Clearing the last active fault recovers: Degraded -> Active -> Idle
+  c.ClearFault(0U);
+  REQUIRE(c.GetGlobalHsm().IsIdle());
+  REQUIRE_FALSE(c.IsAdmissionThrottled());
+}
+
+TEST_CASE("Degraded without throttling keeps normal admission", "[admission]") {
+  TestCollector c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterHook(0U, DeferHook);
+
+  c.ReportFault(0U, 0U, fccu::FaultPriority::kCritical);
+  REQUIRE(c.GetGlobalHsm().IsDegraded());
+  REQUIRE_FALSE(c.IsAdmissionThrottled());
+
+  uint32_t admitted = 0U;
+  for (uint32_t i = 0U; i < 8U; ++i) {
+    if (c.ReportFault(0U, i, fccu::FaultPriority::kMedium) == fccu::FccuError::kOk) {
+      ++admitted;
+    }
+  }
+  REQUIRE(admitted == 6U);
+}
+
 // ============================================================================
 // Statistics Tests
 // ============================================================================
@@ -252,6 +471,38 @@ TEST_CASE("ResetStatistics", "[stats]") {
   REQUIRE(stats.total_processed == 0U);
 }
 
+TEST_CASE("Statistics are summed across producer shards", "[stats]") {
+  fccu::FaultCollector<16, 8, 2, 4, 3> c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterHook(0U, HandledHook);
+  uint8_t lane_a = 0U;
+  uint8_t lane_b = 0U;
+  REQUIRE(c.RegisterProducer(lane_a) == fccu::FccuError::kOk);
+  REQUIRE(c.RegisterProducer(lane_b) == fccu::FccuError::kOk);
+
+  c.ReportFaultFrom(lane_a, 0U, 0U, fccu::FaultPriority::kCritical);
+  c.ReportFaultFrom(lane_b, 0U, 0U, fccu::FaultPriority::kLow);  // Clamped to level 1
+  fccu::FaultReport batch[2] = {{0U, 1U, fccu::FaultPriority::kHigh}, {0U, 2U, fccu::FaultPriority::kMedium}};
+  REQUIRE(c.ReportFaultsFrom(lane_b, batch, 2U).admitted == 2U);
+  REQUIRE(c.ReportFaultFrom(7U, 0U) == fccu::FccuError::kInvalidIndex);
+
+  auto stats = c.GetStatistics();
+  REQUIRE(stats.total_reported == 4U);
+  REQUIRE(stats.priority_reported[0] == 1U);
+  REQUIRE(stats.priority_reported[1] == 3U);
+  REQUIRE(stats.total_dropped == 0U);
+
+  REQUIRE(c.ProcessFaults() == 4U);
+  c.ResetStatistics();
+  c.ReportFaultFrom(lane_a, 0U);
+  c.ProcessFaults();
+  stats = c.GetStatistics();
+  REQUIRE(stats.total_reported == 1U);
+  REQUIRE(stats.total_processed == 1U);
+  REQUIRE(stats.priority_reported[1] == 1U);
+  REQUIRE(stats.priority_reported[0] == 0U);
+}
+
 // ============================================================================
 // Global HSM Tests
 // ============================================================================
@@ -291,6 +542,25 @@ TEST_CASE("Global HSM transitions back to Idle when all cleared", "[hsm]") {
   REQUIRE(c.GetGlobalHsm().IsIdle());
 }
 
+TEST_CASE("HsmDispatchMode::kOnProcess drives HSM from the consumer", "[hsm]") {
+  TestCollector c;
+  c.SetHsmDispatchMode(fccu::HsmDispatchMode::kOnProcess);
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterFault(1U, 0x1002U);
+  c.RegisterHook(0U, DeferHook);
+  c.RegisterHook(1U, HandledHook);
+
+  c.ReportFault(0U, 0U, fccu::FaultPriority::kMedium);
+  c.ReportFault(1U, 0U, fccu::FaultPriority::kCritical);
+  REQUIRE(c.IsFaultActive(0U));
+  REQUIRE(c.GetGlobalHsm().IsIdle());
+
+  c.ProcessFaults();
+  REQUIRE(c.GetGlobalHsm().IsDegraded());
+  REQUIRE(c.IsFaultActive(0U));
+  REQUIRE_FALSE(c.IsFaultActive(1U));
+}
+
 // ============================================================================
 // Per-Fault HSM Tests
 // ============================================================================
@@ -312,6 +582,43 @@ TEST_CASE("BindFaultHsm slot limit", "[per-fault-hsm]") {
   REQUIRE(c.BindFaultHsm(2U) == fccu::FccuError::kHsmSlotFull);
 }
 
+TEST_CASE("BindFaultHsm lookup and rebind", "[per-fault-hsm]") {
+  TestCollector c;
+  c.RegisterFault(3U, 0x1003U);
+  c.RegisterHook(3U, DeferHook);
+  REQUIRE(c.GetFaultHsm(3U) == nullptr);
+  REQUIRE(c.BindFaultHsm(3U, 2U) == fccu::FccuError::kOk);
+  REQUIRE(c.GetFaultHsm(3U) != nullptr);
+  REQUIRE(c.GetFaultHsm(2U) == nullptr);
+
+  c.ReportFault(3U);
+  c.ProcessFaults();
+  REQUIRE(c.GetFaultHsm(3U)->IsDetected());
+  c.ReportFault(3U);
+  c.ProcessFaults();
+  REQUIRE(c.GetFaultHsm(3U)->IsActive());
+
+  // Rebinding reuses the slot and resets the lifecycle
+  REQUIRE(c.BindFaultHsm(3U, 1U) == fccu::FccuError::kOk);
+  REQUIRE(c.GetFaultHsm(3U)->IsDormant());
+}
+
+TEST_CASE("Large per-fault HSM pool", "[per-fault-hsm]") {
+  static fccu::FaultCollector<256, 8, 4, 200> c;
+  for (uint16_t i = 0U; i < 200U; ++i) {
+    c.RegisterFault(i, 0x2000U + i);
+    REQUIRE(c.BindFaultHsm(i) == fccu::FccuError::kOk);
+  }
+  c.RegisterFault(200U, 0x2200U);
+  REQUIRE(c.BindFaultHsm(200U) == fccu::FccuError::kHsmSlotFull);
+
+  c.RegisterHook(199U, DeferHook);
+  c.ReportFault(199U);
+  c.ProcessFaults();
+  REQUIRE(c.GetFaultHsm(199U)->IsActive());
+  REQUIRE(c.GetFaultHsm(0U)->IsDormant());
+}
+
 // ============================================================================
 // Clear Tests
 // ============================================================================
@@ -349,6 +656,65 @@ TEST_CASE("ClearAllFaults", "[clear]") {
   REQUIRE(c.GetGlobalHsm().IsIdle());
 }
 
+TEST_CASE("Active count tracks bit flips only", "[clear]") {
+  TestCollector c;  // QueueDepth = 8, low threshold = 4
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterFault(1U, 0x1002U);
+  c.RegisterHook(0U, DeferHook);
+  c.RegisterHook(1U, DeferHook);
+
+  for (int i = 0; i < 4; ++i) {
+    REQUIRE(c.ReportFault(0U, 0U, fccu::FaultPriority::kLow) == fccu::FccuError::kOk);
+  }
+  REQUIRE(c.ActiveFaultCount() == 1U);
+
+  // Dropped report of an inactive fault leaves no trace in the bitmap
+  REQUIRE(c.ReportFault(1U, 0U, fccu::FaultPriority::kLow) == fccu::FccuError::kQueueFull);
+  REQUIRE_FALSE(c.IsFaultActive(1U));
+  REQUIRE(c.ActiveFaultCount() == 1U);
+
+  c.ProcessFaults();
+  c.ClearFault(1U);  // already inactive: no change
+  REQUIRE(c.ActiveFaultCount() == 1U);
+  c.ClearFault(0U);
+  REQUIRE(c.ActiveFaultCount() == 0U);
+  REQUIRE(c.GetGlobalHsm().IsIdle());
+}
+
+TEST_CASE("4096-fault collector with hierarchical bitmap", "[clear][scale]") {
+  static fccu::FaultCollector<4096, 16, 4, 0> c;
+  const fccu::FaultIndex indices[] = {0U, 63U, 64U, 1000U, 4095U};
+  for (auto idx : indices) {
+    REQUIRE(c.RegisterFault(idx, 0x5000U + idx) == fccu::FccuError::kOk);
+    c.RegisterHook(idx, DeferHook);
+    REQUIRE(c.ReportFault(idx, 0U, fccu::FaultPriority::kCritical) == fccu::FccuError::kOk);
+  }
+  REQUIRE(c.RegisterFault(4096U, 0U) == fccu::FccuError::kInvalidIndex);
+  REQUIRE(c.ActiveFaultCount() == 5U);
+  REQUIRE(c.IsFaultActive(4095U));
+
+  std::vector<fccu::FaultIndex> seen;
+  c.ForEachActive([&](fccu::FaultIndex idx) { seen.push_back(idx); });
+  REQUIRE(seen.size() == 5U);
+  for (size_t i = 0U; i < seen.size(); ++i) {
+    REQUIRE(seen[i] == indices[i]);
+  }
+
+  c.ProcessFaults();
+  c.ClearFault(63U);
+  c.ClearFault(4095U);
+  seen.clear();
+  c.ForEachActive([&](fccu::FaultIndex idx) { seen.push_back(idx); });
+  REQUIRE(seen.size() == 3U);
+  REQUIRE(seen[2] == 1000U);
+
+  c.ClearAllFaults();
+  REQUIRE(c.ActiveFaultCount() == 0U);
+  seen.clear();
+  c.ForEachActive([&](fccu::FaultIndex idx) { seen.push_back(idx); });
+  REQUIRE(seen.empty());
+}
+
 // ============================================================================
 // Overflow Callback Tests
 // ============================================================================
@@ -370,6 +736,265 @@ TEST_CASE("Overflow callback invoked on queue full", "[overflow]") {
   REQUIRE(overflow_count > 0);
 }
 
+struct DeferredOverflowProbe {
+  uint32_t per_fault[16] = {};
+  uint32_t per_fault_calls = 0U;
+  uint32_t summaries = 0U;
+  fccu::OverflowSummary last{};
+};
+
+struct DeferredOverflowPolicy : fccu::DefaultCollectorPolicy {
+  static constexpr bool kDeferredOverflow = true;
+};
+using DeferredOverflowCollector = fccu::FaultCollector<16, 8, 4, 4, 1, DeferredOverflowPolicy>;
+
+TEST_CASE("Deferred overflow is delivered once per fault by the consumer", "[overflow]") {
+  DeferredOverflowCollector c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterFault(1U, 0x1002U);
+  c.RegisterHook(0U, DeferHook);
+  c.RegisterHook(1U, DeferHook);
+
+  static int immediate_count = 0;
+  immediate_count = 0;
+  c.SetOverflowCallback([](uint16_t, fccu::FaultPriority, void*) { ++immediate_count; });
+
+  DeferredOverflowProbe probe;
+  c.SetOverflowMode(fccu::OverflowMode::kDeferred);
+  c.SetDeferredOverflowCallback(
+      [](uint16_t fi, uint32_t n, void* ctx) {
+        auto* p = static_cast<DeferredOverflowProbe*>(ctx);
+        p->per_fault[fi] += n;
+        ++p->per_fault_calls;
+      },
+      &probe);
+  c.SetOverflowSummaryCallback(
+      [](const fccu::OverflowSummary& sum, void* ctx) {
+        auto* p = static_cast<DeferredOverflowProbe*>(ctx);
+        ++p->summaries;
+        p->last = sum;
+      },
+      &probe);
+
+  // Low level admits 4 of 8 slots: fault 0 drops 6, fault 1 (batch) drops 3
+  for (uint32_t i = 0U; i < 10U; ++i) {
+    c.ReportFault(0U, i, fccu::FaultPriority::kLow);
+  }
+  fccu::FaultReport batch[3] = {{1U, 0U, fccu::FaultPriority::kLow},
+                                {1U, 1U, fccu::FaultPriority::kLow},
+                                {1U, 2U, fccu::FaultPriority::kLow}};
+  REQUIRE(c.ReportFaults(batch, 3U).dropped == 3U);
+  REQUIRE(immediate_count == 0);
+  REQUIRE(probe.per_fault_calls == 0U);
+
+  REQUIRE(c.ProcessFaults() == 4U);
+  REQUIRE(probe.per_fault_calls == 2U);
+  REQUIRE(probe.per_fault[0] == 6U);
+  REQUIRE(probe.per_fault[1] == 3U);
+  REQUIRE(probe.summaries == 1U);
+  REQUIRE(probe.last.fault_count == 2U);
+  REQUIRE(probe.last.drop_count == 9U);
+  REQUIRE(c.GetStatistics().total_dropped == 9U);
+
+  // Nothing new dropped: nothing delivered
+  c.ProcessFaults();
+  REQUIRE(probe.per_fault_calls == 2U);
+  REQUIRE(probe.summaries == 1U);
+}
+
+TEST_CASE("Deferred overflow storage is opt-in", "[overflow]") {
+  static_assert(!fccu::DefaultCollectorPolicy::kDeferredOverflow, "baseline overflow callbacks by default");
+  static_assert(sizeof(TestCollector) < sizeof(DeferredOverflowCollector), "drop counters compiled out");
+
+  TestCollector c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterHook(0U, DeferHook);
+  static int immediate_count = 0;
+  immediate_count = 0;
+  c.SetOverflowCallback([](uint16_t, fccu::FaultPriority, void*) { ++immediate_count; });
+
+  // kDeferred has no storage: the mode stays kImmediate
+  c.SetOverflowMode(fccu::OverflowMode::kDeferred);
+  REQUIRE(c.GetOverflowMode() == fccu::OverflowMode::kImmediate);
+  for (uint32_t i = 0U; i < 6U; ++i) {
+    c.ReportFault(0U, i, fccu::FaultPriority::kLow);
+  }
+  REQUIRE(immediate_count == 2);
+  REQUIRE(c.ProcessFaults() == 4U);
+}
+
+// ============================================================================
+// Bus Notifier Tests
+// ============================================================================
+
+struct BusProbe {
+  uint32_t events = 0U;
+  uint32_t flushes = 0U;
+  uint32_t events_at_flush = 0U;
+};
+
+TEST_CASE("Bus flush callback runs once per ProcessFaults batch", "[bus]") {
+  TestCollector c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterFault(1U, 0x1002U);
+  c.RegisterHook(0U, DeferHook);
+  c.RegisterHook(1U, DeferHook);
+
+  BusProbe probe;
+  c.SetBusNotifier([](const fccu::FaultEvent&, void* ctx) { ++static_cast<BusProbe*>(ctx)->events; }, &probe,
+                   [](void* ctx) {
+                     auto* p = static_cast<BusProbe*>(ctx);
+                     ++p->flushes;
+                     p->events_at_flush = p->events;
+                   });
+
+  c.ReportFault(0U, 1U, fccu::FaultPriority::kHigh);
+  c.ReportFault(1U, 2U, fccu::FaultPriority::kLow);
+  c.ReportFault(0U, 3U, fccu::FaultPriority::kMedium);
+  REQUIRE(c.ProcessFaults() == 3U);
+  REQUIRE(probe.flushes == 1U);
+  REQUIRE(probe.events_at_flush == 3U);
+
+  // Nothing processed: no flush
+  REQUIRE(c.ProcessFaults() == 0U);
+  REQUIRE(probe.flushes == 1U);
+}
+
+// Own payload variant per case: mccc::AsyncBus<P>::Instance() is one bus per type
+using BridgeRecords = fccu::FaultRecordBatch<4>;
+using BridgeReports = fccu::FaultReportBatch<4>;
+
+struct BridgeSink {
+  std::vector<uint32_t> counts;
+  std::vector<fccu::FaultIndex> indices;
+};
+
+template <typename Payload>
+static mccc::SubscriptionHandle SubscribeRecords(mccc::AsyncBus<Payload>& bus, BridgeSink& sink) {
+  return bus.template Subscribe<BridgeRecords>([&sink](const typename mccc::AsyncBus<Payload>::EnvelopeType& env) {
+    const auto* batch = std::get_if<BridgeRecords>(&env.payload);
+    sink.counts.push_back(batch->count);
+    for (uint32_t i = 0U; i < batch->count; ++i) {
+      sink.indices.push_back(batch->records[i].fault_index);
+    }
+  });
+}
+
+TEST_CASE("FaultBusPublisher publishes a full batch from inside Append", "[bus]") {
+  using Payload = std::variant<BridgeRecords, fccu::FaultReportBatch<1>>;
+  auto& bus = mccc::AsyncBus<Payload>::Instance();
+  BridgeSink sink;
+  auto handle = SubscribeRecords(bus, sink);
+
+  TestCollector c;
+  for (uint16_t i = 0U; i < 6U; ++i) {
+    c.RegisterFault(i, 0x1000U + i);
+  }
+  c.SetDefaultHook(DeferHook);
+  fccu::FaultBusPublisher<Payload, 4U> publisher(bus, 7U);
+  publisher.Attach(c);
+
+  for (uint16_t i = 0U; i < 6U; ++i) {
+    c.ReportFault(i, i, fccu::FaultPriority::kCritical);
+  }
+  REQUIRE(c.ProcessFaults() == 6U);
+  // The fifth event found the batch full: 4 published there, 2 at the end of ProcessFaults()
+  REQUIRE(publisher.PublishedBatches() == 2U);
+  REQUIRE(publisher.PublishedRecords() == 6U);
+  REQUIRE(publisher.PendingCount() == 0U);
+  bus.ProcessBatch();
+  REQUIRE(sink.counts == std::vector<uint32_t>{4U, 2U});
+  REQUIRE(sink.indices == std::vector<fccu::FaultIndex>{0U, 1U, 2U, 3U, 4U, 5U});
+
+  // The moved-from payload is still an empty Batch and stages the next call afresh
+  c.ReportFault(5U, 9U, fccu::FaultPriority::kLow);
+  REQUIRE(c.ProcessFaults() == 1U);
+  REQUIRE(publisher.PublishedBatches() == 3U);
+  REQUIRE(publisher.PendingCount() == 0U);
+  bus.ProcessBatch();
+  REQUIRE(sink.counts.back() == 1U);
+  REQUIRE(sink.indices.back() == 5U);
+  REQUIRE(bus.Unsubscribe(handle));
+}
+
+/** @brief Bus stand-in whose queue is always full. */
+template <typename Payload>
+struct RefusingBus {
+  uint32_t attempts = 0U;
+  bool Publish(Payload&& /*payload*/, uint32_t /*sender_id*/) noexcept {
+    ++attempts;
+    return false;
+  }
+};
+
+TEST_CASE("FaultBusPublisher counts records the bus refuses", "[bus]") {
+  using Payload = std::variant<BridgeRecords>;
+  RefusingBus<Payload> bus;
+  TestCollector c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterHook(0U, DeferHook);
+  fccu::FaultBusPublisher<Payload, 4U, RefusingBus<Payload>> publisher(bus);
+  publisher.Attach(c);
+
+  for (uint32_t i = 0U; i < 5U; ++i) {
+    c.ReportFault(0U, i, fccu::FaultPriority::kCritical);
+  }
+  REQUIRE(c.ProcessFaults() == 5U);
+  REQUIRE(bus.attempts == 2U);
+  REQUIRE(publisher.DroppedRecords() == 5U);
+  REQUIRE(publisher.PublishedBatches() == 0U);
+  REQUIRE(publisher.PublishedRecords() == 0U);
+  REQUIRE(publisher.PendingCount() == 0U);
+
+  publisher.Flush();  // Nothing staged: no publish attempt
+  REQUIRE(bus.attempts == 2U);
+}
+
+TEST_CASE("FaultBusIngress forwards report batches into its lane", "[bus]") {
+  using Payload = std::variant<BridgeReports, fccu::FaultRecordBatch<1>>;
+  using Collector = fccu::FaultCollector<8, 8, 4, 0, 2>;
+  auto& bus = mccc::AsyncBus<Payload>::Instance();
+  Collector c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterFault(1U, 0x1002U);
+  c.SetDefaultHook(DeferHook);
+  uint8_t lane = 0U;
+  REQUIRE(c.RegisterProducer(lane) == fccu::FccuError::kOk);
+
+  // Lane 0 is full at the critical level; the ingress lane is not
+  while (c.ReportFault(0U, 0U, fccu::FaultPriority::kCritical) == fccu::FccuError::kOk) {
+  }
+  const uint64_t dropped_before = c.GetStatistics().total_dropped;
+
+  {
+    fccu::FaultBusIngress<Collector, Payload, 4U> ingress(c, bus, lane);
+    BridgeReports batch;
+    REQUIRE(batch.Add(0U, 1U, fccu::FaultPriority::kCritical));
+    REQUIRE(batch.Add(1U, 2U, fccu::FaultPriority::kCritical));
+    REQUIRE(batch.Add(7U, 3U, fccu::FaultPriority::kCritical));  // Not registered
+    REQUIRE(bus.Publish(Payload{batch}, 3U));
+    BridgeReports second;
+    REQUIRE(second.Add(1U, 4U, fccu::FaultPriority::kHigh));
+    REQUIRE(bus.Publish(Payload{second}, 3U));
+    bus.ProcessBatch();
+
+    REQUIRE(ingress.BatchesForwarded() == 2U);
+    REQUIRE(ingress.Totals().admitted == 3U);
+    REQUIRE(ingress.Totals().rejected == 1U);
+    REQUIRE(ingress.Totals().dropped == 0U);
+    REQUIRE(ingress.Totals().coalesced == 0U);
+  }
+  REQUIRE(c.GetStatistics().total_dropped == dropped_before);
+  REQUIRE(c.ProcessFaults() == 8U + 3U);
+
+  // Unsubscribed on destruction
+  BridgeReports late;
+  REQUIRE(late.Add(0U));
+  REQUIRE(bus.Publish(Payload{late}, 3U));
+  bus.ProcessBatch();
+  REQUIRE(c.ProcessFaults() == 0U);
+}
+
 // ============================================================================
 // BackpressureLevel Tests
 // ============================================================================
@@ -379,6 +1004,31 @@ TEST_CASE("BackpressureLevel starts Normal", "[backpressure]") {
   REQUIRE(c.GetBackpressureLevel() == fccu::BackpressureLevel::kNormal);
 }
 
+TEST_CASE("BackpressureLevel counts the capacity of every lane", "[backpressure]") {
+  fccu::FaultCollector<16, 8, 4, 4, 4> c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterHook(0U, DeferHook);
+  auto fill_lane = [&c](uint8_t lane) {
+    for (uint8_t level = 0U; level < 4U; ++level) {
+      while (c.ReportFaultFrom(lane, 0U, 0U, static_cast<fccu::FaultPriority>(level)) == fccu::FccuError::kOk) {
+      }
+    }
+  };
+
+  // One full lane (25 of its 32 slots admitted) is a quarter of the set
+  fill_lane(1U);
+  REQUIRE(c.GetQueueSize(0U) == 8U);
+  REQUIRE(c.GetBackpressureLevel() == fccu::BackpressureLevel::kNormal);
+
+  fill_lane(0U);
+  fill_lane(2U);
+  fill_lane(3U);
+  REQUIRE(c.GetBackpressureLevel() == fccu::BackpressureLevel::kWarning);  // 100 of 128
+
+  c.ProcessFaults();
+  REQUIRE(c.GetBackpressureLevel() == fccu::BackpressureLevel::kNormal);
+}
+
 // ============================================================================
 // FaultReporter Tests
 // ============================================================================
@@ -396,6 +1046,99 @@ TEST_CASE("FaultReporter injection point", "[reporter]") {
   REQUIRE_FALSE(c.IsFaultActive(0U));
 }
 
+TEST_CASE("Multiple producers report through their own lanes", "[producer]") {
+  fccu::FaultCollector<16, 64, 4, 4, 5> c;
+  for (uint16_t i = 0U; i < 4U; ++i) {
+    c.RegisterFault(i, 0x1000U + i);
+    c.RegisterHook(i, DeferHook);
+  }
+  REQUIRE(c.GetHsmDispatchMode() == fccu::HsmDispatchMode::kOnProcess);
+
+  std::vector<std::thread> producers;
+  for (uint16_t p = 0U; p < 4U; ++p) {
+    producers.emplace_back([&c, p]() {
+      uint8_t lane = 0U;
+      REQUIRE(c.RegisterProducer(lane) == fccu::FccuError::kOk);
+      for (uint32_t n = 0U; n < 16U; ++n) {
+        c.ReportFaultFrom(lane, p, n, fccu::FaultPriority::kCritical);
+      }
+    });
+  }
+  for (auto& t : producers) {
+    t.join();
+  }
+
+  uint8_t extra = 0U;
+  REQUIRE(c.RegisterProducer(extra) == fccu::FccuError::kProducerSlotFull);
+  REQUIRE(c.GetGlobalHsm().IsIdle());  // producers never touch the HSM
+  REQUIRE(c.ProcessFaults() == 64U);
+  REQUIRE(c.GetStatistics().total_reported == 64U);
+  REQUIRE(c.GetGlobalHsm().IsDegraded());
+}
+
+TEST_CASE("A refused push on one lane cannot deactivate a fault kept active via another", "[producer]") {
+  using Collector = fccu::FaultCollector<8, 4, 4, 0, 3>;
+  struct Race {
+    Collector c;
+    uint8_t lane_a = 0U;
+    uint8_t lane_b = 0U;
+    bool fired = false;
+  };
+  static Race race;
+  Collector& c = race.c;
+  for (uint16_t i = 1U; i < 4U; ++i) {
+    c.RegisterFault(i, 0x1000U + i);
+    c.RegisterHook(i, DeferHook);
+  }
+  REQUIRE(c.RegisterProducer(race.lane_a) == fccu::FccuError::kOk);
+  REQUIRE(c.RegisterProducer(race.lane_b) == fccu::FccuError::kOk);
+
+  // Lane A's low level is at its admission limit
+  while (c.ReportFaultFrom(race.lane_a, 3U, 0U, fccu::FaultPriority::kLow) == fccu::FccuError::kOk) {
+  }
+
+  // Between lane A setting fault 2's bit and undoing it, lane B gets fault 2
+  // admitted and the consumer keeps it active (kDefer).
+  c.SetOverflowCallback([](fccu::FaultIndex, fccu::FaultPriority, void* ctx) {
+    auto* r = static_cast<Race*>(ctx);
+    if (!r->fired) {
+      r->fired = true;
+      REQUIRE(r->c.ReportFaultFrom(r->lane_b, 2U, 0U, fccu::FaultPriority::kHigh) == fccu::FccuError::kOk);
+      REQUIRE(r->c.ProcessFaults() > 0U);
+      REQUIRE(r->c.IsFaultActive(2U));
+    }
+  }, &race);
+  fccu::FaultReport batch[2] = {{1U, 0U, fccu::FaultPriority::kLow}, {2U, 0U, fccu::FaultPriority::kLow}};
+  REQUIRE(c.ReportFaultsFrom(race.lane_a, batch, 2U).dropped == 2U);
+  REQUIRE(race.fired);
+
+  (void)c.ProcessFaults();  // Consumer repairs the bit lane A undid
+  REQUIRE(c.IsFaultActive(2U));
+  REQUIRE_FALSE(c.IsFaultActive(1U));
+  REQUIRE(c.ActiveFaultCount() == 2U);  // Faults 2 and 3
+
+  // The single-report path undoes through the same repair
+  c.SetOverflowCallback(nullptr);
+  while (c.ReportFaultFrom(race.lane_a, 3U, 0U, fccu::FaultPriority::kLow) == fccu::FccuError::kOk) {
+  }
+  REQUIRE(c.ReportFaultFrom(race.lane_a, 1U, 0U, fccu::FaultPriority::kLow) == fccu::FccuError::kQueueFull);
+  REQUIRE_FALSE(c.IsFaultActive(1U));
+}
+
+TEST_CASE("FaultReporter bound to a lane", "[reporter]") {
+  fccu::FaultCollector<16, 8, 4, 4, 2> c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterHook(0U, HandledHook);
+
+  uint8_t lane = 0U;
+  REQUIRE(c.RegisterProducer(lane) == fccu::FccuError::kOk);
+  auto reporter = c.GetReporter(lane);
+  reporter.Report(0U, 0xBEEF, fccu::FaultPriority::kHigh);
+
+  REQUIRE(c.IsFaultActive(0U));
+  REQUIRE(c.ProcessFaults() == 1U);
+}
+
 TEST_CASE("FaultReporter with null fn does nothing", "[reporter]") {
   fccu::FaultReporter reporter{};
   reporter.Report(0U);  // Should not crash
@@ -430,27 +1173,1465 @@ TEST_CASE("ForEachRecent iterates newest first", "[recent]") {
 }
 
 // ============================================================================
-// FaultQueueSet Standalone Tests
+// Clock Policy Tests
 // ============================================================================
 
-TEST_CASE("FaultQueueSet basic push/pop", "[queue]") {
-  fccu::FaultQueueSet<fccu::FaultEntry, 4, 8> qs;
-
-  fccu::FaultEntry entry{};
-  entry.fault_index = 5U;
-  entry.priority = fccu::FaultPriority::kHigh;
+struct TickClockTag {};
 
-  REQUIRE(qs.Push(1U, entry));
-  REQUIRE_FALSE(qs.IsEmpty());
-  REQUIRE(qs.TotalSize() == 1U);
+struct TickPolicy : fccu::DefaultCollectorPolicy {
+  using Clock = fccu::BasicTickClock<TickClockTag>;
+};
 
-  fccu::FaultEntry out{};
-  uint8_t level = 0U;
-  REQUIRE(qs.Pop(out, level));
-  REQUIRE(out.fault_index == 5U);
-  REQUIRE(level == 1U);
-  REQUIRE(qs.IsEmpty());
-}
+struct NullClockPolicy : fccu::DefaultCollectorPolicy {
+  using Clock = fccu::NullClock;
+};
+
+TEST_CASE("TickClock timestamps come from the cached tick", "[clock]") {
+  using Clock = TickPolicy::Clock;
+  fccu::FaultCollector<16, 8, 4, 4, 1, TickPolicy> c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterFault(1U, 0x1002U);
+  c.RegisterHook(0U, HandledHook);
+  c.RegisterHook(1U, HandledHook);
+
+  Clock::Set(1000U);
+  c.ReportFault(0U, 0x11);
+  Clock::Advance(250U);
+  c.ReportFault(1U, 0x22);
+
+  uint64_t ts[2] = {};
+  c.ProcessFaults();
+  c.ForEachRecent([&](const fccu::RecentFaultInfo& info) { ts[info.fault_index] = info.timestamp_us; });
+
+  REQUIRE(ts[0] == 1000U);
+  REQUIRE(ts[1] == 1250U);
+}
+
+TEST_CASE("NullClock yields zero timestamps", "[clock]") {
+  fccu::FaultCollector<16, 8, 4, 4, 1, NullClockPolicy> c;
+  c.RegisterFault(0U, 0x1001U);
+  uint64_t seen = 1U;
+  c.RegisterHook(
+      0U,
+      [](const fccu::FaultEvent& e, void* ctx) -> fccu::HookAction {
+        *static_cast<uint64_t*>(ctx) = e.timestamp_us;
+        return fccu::HookAction::kHandled;
+      },
+      &seen);
+
+  c.ReportFault(0U);
+  REQUIRE(c.ProcessFaults() == 1U);
+  REQUIRE(seen == 0U);
+  REQUIRE_FALSE(fccu::NullClock::kEnabled);
+}
+
+struct CycleClockPolicy : fccu::DefaultCollectorPolicy {
+  using Clock = fccu::CycleCounterClock;
+};
+
+TEST_CASE("A collector on CycleCounterClock calibrates before the first hook", "[clock]") {
+  fccu::FaultCollector<4, 8, 4, 0, 1, CycleClockPolicy> c;
+  REQUIRE(fccu::CycleCounterClock::IsCalibrated());
+  c.RegisterFault(0U, 0x1001U);
+  static uint64_t seen_us = 0U;
+  c.RegisterHook(0U, [](const fccu::FaultEvent& e, void*) -> fccu::HookAction {
+    seen_us = e.timestamp_us;
+    return fccu::HookAction::kHandled;
+  });
+  c.ReportFault(0U);
+  REQUIRE(c.ProcessFaults() == 1U);
+  REQUIRE(seen_us != 0U);
+}
+
+TEST_CASE("Clock conversions", "[clock]") {
+  REQUIRE(fccu::detail::ScaleTicks(0xFFFFFFFFFFFFULL, 1000U, 1000000U) == 0xFFFFFFFFFFFFULL / 1000U);
+  REQUIRE(fccu::detail::ScaleTicks(123U, 1U, 0U) == 0U);
+
+  // steady_clock ticks convert to the same value chrono would produce
+  uint64_t raw = fccu::SteadyClock::Now();
+  auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::duration(static_cast<std::chrono::steady_clock::rep>(raw)));
+  REQUIRE(fccu::SteadyClock::ToUs(raw) == static_cast<uint64_t>(us.count()));
+
+  // Cycle counter is monotonic and converts to roughly elapsed wall time
+  fccu::CycleCounterClock::Calibrate(2000U);
+  uint64_t c0 = fccu::CycleCounterClock::Now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  uint64_t c1 = fccu::CycleCounterClock::Now();
+  REQUIRE(c1 > c0);
+  uint64_t elapsed_us = fccu::CycleCounterClock::ToUs(c1 - c0);
+  REQUIRE(elapsed_us >= 4000U);
+  REQUIRE(elapsed_us < 1000000U);
+}
+
+// ============================================================================
+// Coalescing Tests
+// ============================================================================
+
+struct CoalescePolicy : fccu::DefaultCollectorPolicy {
+  static constexpr bool kCoalescing = true;
+};
+
+struct CoalesceProbe {
+  uint32_t events = 0U;
+  uint64_t reports = 0U;
+  fccu::FaultEvent last{};
+};
+
+static fccu::HookAction CoalesceProbeHook(const fccu::FaultEvent& e, void* ctx) {
+  auto* probe = static_cast<CoalesceProbe*>(ctx);
+  ++probe->events;
+  probe->reports += e.coalesced_count;
+  probe->last = e;
+  return fccu::HookAction::kHandled;
+}
+
+TEST_CASE("Coalescing folds duplicate reports into one event", "[coalesce]") {
+  fccu::FaultCollector<16, 8, 4, 4, 1, CoalescePolicy> c;
+  CoalesceProbe probe;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterFault(1U, 0x1002U);
+  c.RegisterHook(0U, CoalesceProbeHook, &probe);
+  c.RegisterHook(1U, HandledHook);
+  REQUIRE(c.SetCoalescing(0U) == fccu::FccuError::kOk);
+  REQUIRE(c.SetCoalescing(5U) == fccu::FccuError::kNotRegistered);
+
+  for (uint32_t i = 0U; i < 1000U; ++i) {
+    REQUIRE(c.ReportFault(0U, i, fccu::FaultPriority::kLow) == fccu::FccuError::kOk);
+  }
+  auto stats = c.GetStatistics();
+  REQUIRE(stats.total_reported == 1U);
+  REQUIRE(stats.total_coalesced == 999U);
+  REQUIRE(stats.total_dropped == 0U);
+
+  // Fault 1 is not coalescing: every report takes a slot
+  c.ReportFault(1U);
+  c.ReportFault(1U);
+  REQUIRE(c.GetStatistics().total_reported == 3U);
+
+  REQUIRE(c.ProcessFaults() == 3U);
+  REQUIRE(probe.events == 1U);
+  REQUIRE(probe.last.coalesced_count == 1000U);
+  REQUIRE(probe.last.occurrence_count == 1000U);
+  REQUIRE(probe.last.detail == 999U);  // Latest detail
+  REQUIRE(probe.last.is_first);
+
+  // Nothing pending any more: the next report enqueues again
+  c.ReportFault(0U, 7U, fccu::FaultPriority::kLow);
+  REQUIRE(c.GetStatistics().total_reported == 4U);
+  c.ProcessFaults();
+  REQUIRE(probe.events == 2U);
+  REQUIRE(probe.last.coalesced_count == 1U);
+  REQUIRE(probe.last.detail == 7U);
+  REQUIRE(probe.last.occurrence_count == 1001U);
+}
+
+TEST_CASE("Coalescing never delays a more urgent report", "[coalesce]") {
+  fccu::FaultCollector<16, 8, 4, 4, 1, CoalescePolicy> c;
+  CoalesceProbe probe;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterHook(0U, CoalesceProbeHook, &probe);
+  c.SetCoalescing(0U);
+
+  c.ReportFault(0U, 1U, fccu::FaultPriority::kLow);
+  c.ReportFault(0U, 2U, fccu::FaultPriority::kLow);
+  c.ReportFault(0U, 3U, fccu::FaultPriority::kCritical);  // Enqueued separately
+  c.ReportFault(0U, 4U, fccu::FaultPriority::kLow);       // Joins the pending low entry
+  REQUIRE(c.GetStatistics().total_reported == 2U);
+  REQUIRE(c.GetStatistics().total_coalesced == 2U);
+
+  // The critical entry is processed first and absorbs the pending count;
+  // the low entry then has nothing left and is skipped.
+  REQUIRE(c.ProcessFaults() == 2U);
+  REQUIRE(probe.events == 1U);
+  REQUIRE(probe.last.priority == fccu::FaultPriority::kCritical);
+  REQUIRE(probe.last.detail == 3U);
+  REQUIRE(probe.reports == 4U);
+  REQUIRE(c.ActiveFaultCount() == 0U);
+}
+
+TEST_CASE("Coalescing in ReportFaults batches", "[coalesce]") {
+  fccu::FaultCollector<16, 8, 4, 4, 1, CoalescePolicy> c;
+  CoalesceProbe probe;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterHook(0U, CoalesceProbeHook, &probe);
+  c.SetCoalescing(0U);
+
+  fccu::FaultReport batch[5] = {};
+  for (uint32_t i = 0U; i < 5U; ++i) {
+    batch[i] = fccu::FaultReport{0U, 10U + i, fccu::FaultPriority::kMedium};
+  }
+  auto result = c.ReportFaults(batch, 5U);
+  REQUIRE(result.admitted == 1U);
+  REQUIRE(result.coalesced == 4U);
+  REQUIRE(result.dropped == 0U);
+  REQUIRE(c.GetStatistics().total_coalesced == 4U);
+
+  REQUIRE(c.ProcessFaults() == 1U);
+  REQUIRE(probe.last.coalesced_count == 5U);
+  REQUIRE(probe.last.detail == 14U);
+}
+
+TEST_CASE("Coalescing keeps exact accounting with concurrent producers", "[coalesce][concurrency]") {
+  fccu::FaultCollector<4, 64, 4, 0, 3, CoalescePolicy> c;
+  CoalesceProbe probe;
+  for (uint16_t i = 0U; i < 4U; ++i) {
+    c.RegisterFault(i, 0x1000U + i);
+    c.RegisterHook(i, CoalesceProbeHook, &probe);
+    c.SetCoalescing(i);
+  }
+
+  constexpr uint32_t kPerProducer = 20000U;
+  std::atomic<bool> done{false};
+  std::thread consumer([&]() {
+    while (!done.load(std::memory_order_acquire)) {
+      c.ProcessFaults();
+    }
+    c.ProcessFaults();
+  });
+  std::vector<std::thread> producers;
+  for (uint32_t p = 0U; p < 2U; ++p) {
+    producers.emplace_back([&c, p]() {
+      uint8_t lane = 0U;
+      REQUIRE(c.RegisterProducer(lane) == fccu::FccuError::kOk);
+      for (uint32_t n = 0U; n < kPerProducer; ++n) {
+        c.ReportFaultFrom(lane, static_cast<fccu::FaultIndex>((n + p) % 4U), n, fccu::FaultPriority::kHigh);
+      }
+    });
+  }
+  for (auto& t : producers) {
+    t.join();
+  }
+  done.store(true, std::memory_order_release);
+  consumer.join();
+
+  auto stats = c.GetStatistics();
+  REQUIRE(stats.total_dropped == 0U);
+  REQUIRE(stats.total_reported + stats.total_coalesced == 2U * kPerProducer);
+  REQUIRE(probe.reports == 2U * kPerProducer);
+}
+
+// ============================================================================
+// Static Hook Tests
+// ============================================================================
+
+static uint32_t g_static_calls[3] = {};
+
+static fccu::HookAction StaticDeferHook(const fccu::FaultEvent& /*e*/) {
+  ++g_static_calls[0];
+  return fccu::HookAction::kDefer;
+}
+
+static fccu::HookAction StaticHandledHook(const fccu::FaultEvent& /*e*/) {
+  ++g_static_calls[1];
+  return fccu::HookAction::kHandled;
+}
+
+static fccu::HookAction StaticFallbackHook(const fccu::FaultEvent& /*e*/) {
+  ++g_static_calls[2];
+  return fccu::HookAction::kDefer;
+}
+
+struct StaticHookPolicy : fccu::DefaultCollectorPolicy {
+  using Hooks = fccu::StaticHookTable<&StaticFallbackHook, fccu::StaticHook<0, &StaticDeferHook>,
+                                      fccu::StaticHook<2, &StaticHandledHook>>;
+};
+
+struct StaticNoDefaultPolicy : fccu::DefaultCollectorPolicy {
+  using Hooks = fccu::StaticHookTable<nullptr, fccu::StaticHook<1, &StaticDeferHook>>;
+};
+
+TEST_CASE("StaticHookTable dispatches by fault index with a fallback", "[hooks]") {
+  g_static_calls[0] = g_static_calls[1] = g_static_calls[2] = 0U;
+  fccu::FaultCollector<4, 8, 4, 0, 1, StaticHookPolicy> c;
+  for (uint16_t i = 0U; i < 4U; ++i) {
+    c.RegisterFault(i, 0x1000U + i);
+  }
+  static_assert(StaticHookPolicy::Hooks::IndexBound() == 3U, "bound");
+
+  c.ReportFault(0U);
+  c.ReportFault(2U);
+  c.ReportFault(3U);
+  REQUIRE(c.ProcessFaults() == 3U);
+  REQUIRE(g_static_calls[0] == 1U);
+  REQUIRE(g_static_calls[1] == 1U);
+  REQUIRE(g_static_calls[2] == 1U);
+
+  // kDefer keeps faults 0 and 3 active, kHandled cleared 2
+  REQUIRE(c.IsFaultActive(0U));
+  REQUIRE_FALSE(c.IsFaultActive(2U));
+  REQUIRE(c.IsFaultActive(3U));
+}
+
+TEST_CASE("StaticHookTable without a default treats unbound faults as handled", "[hooks]") {
+  g_static_calls[0] = 0U;
+  fccu::FaultCollector<4, 8, 4, 0, 1, StaticNoDefaultPolicy> c;
+  c.RegisterFault(0U, 0x1000U);
+  c.RegisterFault(1U, 0x1001U);
+
+  c.ReportFault(0U);
+  c.ReportFault(1U);
+  REQUIRE(c.ProcessFaults() == 2U);
+  REQUIRE(g_static_calls[0] == 1U);
+  REQUIRE_FALSE(c.IsFaultActive(0U));
+  REQUIRE(c.IsFaultActive(1U));
+}
+
+// ============================================================================
+// Static Fault Table Tests
+// ============================================================================
+
+inline constexpr std::array<fccu::FaultDescriptor, 3> kTestFaultTable{{
+    {0U, 0xA000U, 0U, 1U, fccu::FaultPriority::kCritical, true},
+    {5U, 0xA005U, 0U, 2U, fccu::FaultPriority::kLow, false},
+    {9U, 0xA009U},
+}};
+
+struct StaticTablePolicy : fccu::DefaultCollectorPolicy {
+  using FaultTable = fccu::StaticFaultTable<kTestFaultTable>;
+};
+
+struct TableProbe {
+  fccu::FaultEvent last{};
+  uint32_t calls = 0U;
+};
+
+static fccu::HookAction TableProbeHook(const fccu::FaultEvent& e, void* ctx) {
+  auto* p = static_cast<TableProbe*>(ctx);
+  p->last = e;
+  ++p->calls;
+  return fccu::HookAction::kDefer;
+}
+
+TEST_CASE("StaticFaultTable registers faults at compile time", "[fault-table]") {
+  using Table = StaticTablePolicy::FaultTable;
+  static_assert(Table::kSize == 3U, "size");
+  static_assert(Table::IndexBound() == 10U, "bound");
+  static_assert(Table::Contains(5U) && !Table::Contains(4U), "contains");
+  static_assert(Table::Find(5U).fault_code == 0xA005U, "find");
+
+  fccu::FaultCollector<16, 8, 4, 2, 1, StaticTablePolicy> c;
+  TableProbe probe;
+  c.SetDefaultHook(TableProbeHook, &probe);
+  REQUIRE(c.GetFaultHsm(0U) != nullptr);  // bind_hsm
+  REQUIRE(c.GetFaultHsm(5U) == nullptr);
+
+  // Unlisted indices are still rejected on the runtime path
+  REQUIRE(c.ReportFault(4U) == fccu::FccuError::kNotRegistered);
+  REQUIRE(c.ReportFault(5U, 7U, fccu::FaultPriority::kLow) == fccu::FccuError::kOk);
+
+  REQUIRE(c.ReportFault<0>(1U) == fccu::FccuError::kOk);  // Descriptor priority: kCritical
+  REQUIRE(c.ProcessFaults() == 2U);
+  REQUIRE(probe.last.fault_index == 5U);  // kCritical went first
+  REQUIRE(probe.last.fault_code == 0xA005U);
+
+  REQUIRE(c.ReportFault<9>(3U, fccu::FaultPriority::kHigh) == fccu::FccuError::kOk);
+  REQUIRE(c.ProcessFaults() == 1U);
+  REQUIRE(probe.last.fault_code == 0xA009U);
+  REQUIRE(probe.last.priority == fccu::FaultPriority::kHigh);
+  REQUIRE(probe.calls == 3U);
+}
+
+// ============================================================================
+// Consumer Wakeup Tests
+// ============================================================================
+
+template <typename N>
+struct NotifyPolicy : fccu::DefaultCollectorPolicy {
+  using Notifier = N;
+  static constexpr uint32_t kWaitSpins = 16U;
+};
+
+static fccu::HookAction CountHook(const fccu::FaultEvent& /*e*/, void* ctx) {
+  static_cast<std::atomic<uint32_t>*>(ctx)->fetch_add(1U, std::memory_order_relaxed);
+  return fccu::HookAction::kDefer;
+}
+
+template <typename N>
+static void RunParkedConsumer() {
+  fccu::FaultCollector<4, 64, 4, 0, 2, NotifyPolicy<N>> c;
+  std::atomic<uint32_t> handled{0U};
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterFault(1U, 0x1002U);
+  c.RegisterHook(0U, CountHook, &handled);
+  c.RegisterHook(1U, CountHook, &handled);
+
+  constexpr uint32_t kRounds = 200U;
+  std::atomic<bool> done{false};
+  std::thread consumer([&]() {
+    while (!done.load(std::memory_order_acquire)) {
+      c.WaitAndProcess();  // No timeout: only a signal can wake it
+    }
+    c.ProcessFaults();
+  });
+
+  uint8_t lane = 0U;
+  REQUIRE(c.RegisterProducer(lane) == fccu::FccuError::kOk);
+  for (uint32_t n = 0U; n < kRounds; ++n) {
+    if ((n % 2U) == 0U) {
+      c.ReportFaultFrom(lane, 0U, n, fccu::FaultPriority::kCritical);
+    } else {
+      fccu::FaultReport batch[2] = {{1U, n, fccu::FaultPriority::kLow}, {1U, n, fccu::FaultPriority::kLow}};
+      c.ReportFaultsFrom(lane, batch, 2U);
+    }
+    // Let the consumer drain and park again, so every round exercises a wakeup
+    if ((n % 16U) == 0U) {
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+  }
+  while (handled.load(std::memory_order_relaxed) < kRounds / 2U * 3U) {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  done.store(true, std::memory_order_release);
+  c.NotifyConsumer();
+  consumer.join();
+
+  REQUIRE(handled.load() == kRounds / 2U * 3U);
+  REQUIRE(c.GetStatistics().total_dropped == 0U);
+}
+
+TEST_CASE("WaitAndProcess wakes a parked consumer (CondVarNotifier)", "[notifier][concurrency]") {
+  RunParkedConsumer<fccu::CondVarNotifier>();
+}
+
+#if defined(__linux__)
+TEST_CASE("WaitAndProcess wakes a parked consumer (FutexNotifier)", "[notifier][concurrency]") {
+  RunParkedConsumer<fccu::FutexNotifier>();
+}
+
+TEST_CASE("WaitAndProcess wakes a parked consumer (EventFdNotifier)", "[notifier][concurrency]") {
+  RunParkedConsumer<fccu::EventFdNotifier>();
+}
+#endif
+
+TEST_CASE("WaitAndProcess returns after the timeout when idle", "[notifier]") {
+  fccu::FaultCollector<4, 8, 4, 0, 1, NotifyPolicy<fccu::CondVarNotifier>> c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterHook(0U, DeferHook);
+
+  auto t0 = std::chrono::steady_clock::now();
+  REQUIRE(c.WaitAndProcess(2000U) == 0U);
+  REQUIRE(std::chrono::steady_clock::now() - t0 >= std::chrono::microseconds(2000));
+
+  // Already queued work is processed without parking
+  c.ReportFault(0U, 1U, fccu::FaultPriority::kLow);
+  REQUIRE(c.WaitAndProcess(1000000U) == 1U);
+}
+
+// ============================================================================
+// Shared Memory Tests
+// ============================================================================
+
+#if defined(__linux__)
+using ShmCollector = fccu::FaultCollector<8, 16, 4, 2, 4, fccu::ShmCollectorPolicy>;
+
+static std::string ShmTestName(const char* tag) {
+  return std::string("/fccu_test_") + tag + "_" + std::to_string(getpid());
+}
+
+TEST_CASE("Shared-memory client reports into the host collector", "[shm]") {
+  const std::string name = ShmTestName("basic");
+  fccu::ShmFaultCollectorHost<ShmCollector> host;
+  REQUIRE(host.Create(name.c_str()) == fccu::FccuError::kOk);
+  ShmCollector& c = *host.Get();
+  REQUIRE(c.GetHsmDispatchMode() == fccu::HsmDispatchMode::kOnProcess);
+  REQUIRE(c.GetOverflowMode() == fccu::OverflowMode::kDeferred);
+  c.RegisterFault(0U, 0x5000U);
+  c.RegisterFault(1U, 0x5001U);
+  std::atomic<uint32_t> handled{0U};
+  c.SetDefaultHook(CountHook, &handled);
+
+  // Not published yet
+  fccu::ShmFaultClient<ShmCollector> client;
+  REQUIRE(client.Open(name.c_str()) == fccu::FccuError::kShmNotReady);
+
+  host.Publish();
+  REQUIRE(client.Open(name.c_str()) == fccu::FccuError::kOk);  // Separate mapping of the same region
+  REQUIRE(client.ReportFault(0U, 1U, fccu::FaultPriority::kHigh) == fccu::FccuError::kOk);
+  fccu::FaultReport batch[2] = {{1U, 2U, fccu::FaultPriority::kLow}, {7U, 3U, fccu::FaultPriority::kLow}};
+  auto result = client.ReportFaults(batch, 2U);
+  REQUIRE(result.admitted == 1U);
+  REQUIRE(result.rejected == 1U);
+  client.GetReporter().Report(1U, 4U, fccu::FaultPriority::kMedium);
+  REQUIRE(client.IsFaultActive(1U));
+
+  REQUIRE(c.ProcessFaults() == 3U);
+  REQUIRE(handled.load() == 3U);
+  REQUIRE(c.GetStatistics().total_reported == 3U);
+
+  // A client built for another layout is refused
+  fccu::ShmFaultClient<fccu::FaultCollector<4, 16, 4, 2, 4, fccu::ShmCollectorPolicy>> other;
+  REQUIRE(other.Open(name.c_str()) == fccu::FccuError::kShmLayoutMismatch);
+
+  host.Close();
+  REQUIRE_FALSE(client.IsAttached());
+  REQUIRE(client.ReportFault(0U) == fccu::FccuError::kShmNotReady);
+}
+
+TEST_CASE("Shared-memory client in a child process", "[shm]") {
+  const std::string name = ShmTestName("fork");
+  fccu::ShmFaultCollectorHost<ShmCollector> host;
+  REQUIRE(host.Create(name.c_str()) == fccu::FccuError::kOk);
+  ShmCollector& c = *host.Get();
+  c.RegisterFault(0U, 0x5000U);
+  std::atomic<uint32_t> handled{0U};
+  c.SetDefaultHook(CountHook, &handled);
+  host.Publish();
+
+  pid_t pid = fork();
+  REQUIRE(pid >= 0);
+  if (pid == 0) {
+    fccu::ShmFaultClient<ShmCollector> client;
+    int rc = (client.Open(name.c_str()) == fccu::FccuError::kOk) ? 0 : 1;
+    for (uint32_t i = 0U; rc == 0 && i < 10U; ++i) {
+      rc = (client.ReportFault(0U, i, fccu::FaultPriority::kHigh) == fccu::FccuError::kOk) ? 0 : 2;
+    }
+    client.Close();
+    _exit(rc);
+  }
+  int status = -1;
+  REQUIRE(waitpid(pid, &status, 0) == pid);
+  REQUIRE(WIFEXITED(status));
+  REQUIRE(WEXITSTATUS(status) == 0);
+
+  REQUIRE(c.ProcessFaults() == 10U);
+  REQUIRE(handled.load() == 10U);
+}
+
+TEST_CASE("Shared-memory host only replaces the region of a dead host", "[shm]") {
+  const std::string name = ShmTestName("stale");
+  fccu::ShmFaultCollectorHost<ShmCollector> host;
+  REQUIRE(host.Create(name.c_str()) == fccu::FccuError::kOk);
+
+  // A live host keeps its region
+  fccu::ShmFaultCollectorHost<ShmCollector> second;
+  REQUIRE(second.Create(name.c_str()) == fccu::FccuError::kShmUnavailable);
+  REQUIRE(second.Get() == nullptr);
+  host.Close();
+
+  // A host that exits without Close() leaves a stale region behind
+  pid_t pid = fork();
+  REQUIRE(pid >= 0);
+  if (pid == 0) {
+    auto* crashed = new fccu::ShmFaultCollectorHost<ShmCollector>();
+    int rc = (crashed->Create(name.c_str()) == fccu::FccuError::kOk) ? 0 : 1;
+    _exit(rc);
+  }
+  int status = -1;
+  REQUIRE(waitpid(pid, &status, 0) == pid);
+  REQUIRE(WIFEXITED(status));
+  REQUIRE(WEXITSTATUS(status) == 0);
+
+  REQUIRE(second.Create(name.c_str()) == fccu::FccuError::kOk);
+  REQUIRE(second.Get() != nullptr);
+}
+#endif
+
+// ============================================================================
+// Fault Recorder Tests
+// ============================================================================
+
+TEST_CASE("FaultRecorder streams processed events with per-record CRCs", "[recorder]") {
+  alignas(8) static uint8_t region[fccu::RecorderRegionSize(8U)];
+  std::memset(region, 0xA5, sizeof(region));  // Garbage: must be reinitialised
+
+  TestCollector c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterFault(1U, 0x1002U);
+  c.RegisterHook(0U, DeferHook);
+  c.RegisterHook(1U, DeferHook);
+
+  fccu::FaultRecorder rec;
+  REQUIRE(rec.OpenIn(region, sizeof(region)) == fccu::FccuError::kOk);
+  REQUIRE(rec.Capacity() == 8U);
+  rec.Attach(c);
+
+  for (uint32_t i = 0U; i < 5U; ++i) {
+    c.ReportFault(static_cast<fccu::FaultIndex>(i % 2U), i, fccu::FaultPriority::kMedium);
+  }
+  REQUIRE(c.ProcessFaults() == 5U);
+  REQUIRE(rec.NextSeq() == 5U);
+  const auto& header = *reinterpret_cast<const fccu::RecorderHeader*>(region);
+  REQUIRE(header.committed_seq == 5U);  // Once per ProcessFaults()
+
+  std::vector<uint32_t> details;
+  REQUIRE(fccu::ForEachRecorded(region, sizeof(region), [&](const fccu::RecordedFault& r) {
+            details.push_back(r.detail);
+          }) == 5U);
+  REQUIRE(details == std::vector<uint32_t>{0U, 1U, 2U, 3U, 4U});
+
+  // A torn record is skipped, the rest survive
+  auto* records = reinterpret_cast<fccu::RecordedFault*>(region + sizeof(fccu::RecorderHeader));
+  records[2].detail ^= 0xFFU;
+  uint32_t skipped = 0U;
+  REQUIRE(fccu::ForEachRecorded(region, sizeof(region), [](const fccu::RecordedFault&) {}, &skipped) == 4U);
+  REQUIRE(skipped == 1U);
+}
+
+TEST_CASE("FaultRecorder resumes after reopen and wraps oldest-first", "[recorder]") {
+  alignas(8) static uint8_t region[fccu::RecorderRegionSize(4U)];
+  std::memset(region, 0, sizeof(region));
+  fccu::FaultEvent e{};
+  {
+    fccu::FaultRecorder rec;
+    REQUIRE(rec.OpenIn(region, sizeof(region)) == fccu::FccuError::kOk);
+    for (uint32_t i = 0U; i < 3U; ++i) {
+      e.detail = i;
+      rec.Append(e);
+    }
+  }  // "Reset": no further flush needed, records carry their own seq
+
+  fccu::FaultRecorder rec;
+  REQUIRE(rec.OpenIn(region, sizeof(region)) == fccu::FccuError::kOk);
+  REQUIRE(rec.NextSeq() == 3U);
+  for (uint32_t i = 3U; i < 7U; ++i) {
+    e.detail = i;
+    rec.Append(e);
+  }
+  std::vector<uint64_t> seqs;
+  REQUIRE(fccu::ForEachRecorded(region, sizeof(region), [&](const fccu::RecordedFault& r) {
+            seqs.push_back(r.seq);
+            REQUIRE(r.detail == r.seq);
+          }) == 4U);
+  REQUIRE(seqs == std::vector<uint64_t>{3U, 4U, 5U, 6U});
+}
+
+// ============================================================================
+// Snapshot Tests
+// ============================================================================
+
+struct SnapshotPolicy : fccu::DefaultCollectorPolicy {
+  static constexpr bool kSnapshots = true;
+};
+
+using SnapshotCollector = fccu::FaultCollector<16, 8, 4, 4, 1, SnapshotPolicy>;
+
+TEST_CASE("Snapshot captures bitmap, stats, HSMs, queues and recent ring together", "[snapshot]") {
+  SnapshotCollector c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterFault(3U, 0x1004U, 0U, 2U);
+  c.SetDefaultHook(DeferHook);
+  REQUIRE(c.BindFaultHsm(3U, 2U) == fccu::FccuError::kOk);
+
+  SnapshotCollector::StateSnapshot snap;
+  REQUIRE_FALSE(c.Snapshot(snap));  // Nothing published yet
+
+  c.ReportFault(0U, 0x10U, fccu::FaultPriority::kHigh);
+  c.ReportFault(3U, 0x30U, fccu::FaultPriority::kLow);
+  c.ReportFault(3U, 0x31U, fccu::FaultPriority::kLow);
+  REQUIRE(c.ProcessFaults(2U) == 2U);  // One kLow entry stays queued
+
+  REQUIRE(c.Snapshot(snap));
+  REQUIRE(snap.version == 1U);
+  REQUIRE(snap.stats.total_reported == 3U);
+  REQUIRE(snap.stats.total_processed == 2U);
+  REQUIRE(snap.active_count == 2U);
+  REQUIRE(snap.IsFaultActive(0U));
+  REQUIRE(snap.IsFaultActive(3U));
+  REQUIRE_FALSE(snap.IsFaultActive(1U));
+  REQUIRE(snap.global_state == fccu::GlobalState::kActive);
+  REQUIRE(snap.queue_depth[3] == 1U);
+  REQUIRE(snap.queue_depth[1] == 0U);
+  REQUIRE(snap.fault_hsm_count == 1U);
+  REQUIRE(snap.fault_hsms[0].fault_index == 3U);
+  REQUIRE(snap.fault_hsms[0].state == fccu::FaultState::kDetected);  // Confirmed once 2 are processed
+  REQUIRE(snap.fault_hsms[0].occurrence_count == 2U);
+  REQUIRE(std::string(fccu::FaultStateName(snap.fault_hsms[0].state)) == "Detected");
+  REQUIRE(snap.recent_count == 2U);
+  REQUIRE(snap.recent[0].detail == 0x30U);  // Newest first
+  REQUIRE(snap.recent[1].detail == 0x10U);
+
+  // Consumer-side changes outside ProcessFaults() show up after an explicit publish
+  c.ClearAllFaults();
+  REQUIRE(c.Snapshot(snap));
+  REQUIRE(snap.active_count == 2U);
+  c.PublishSnapshot();
+  REQUIRE(c.Snapshot(snap));
+  REQUIRE(snap.version == 2U);
+  REQUIRE(snap.active_count == 0U);
+  REQUIRE(snap.global_state == fccu::GlobalState::kIdle);
+}
+
+TEST_CASE("SeqLock readers never observe a torn value", "[snapshot][concurrency]") {
+  struct Payload {
+    std::array<uint64_t, 24> words;
+    uint32_t tail;
+  };
+  static fccu::SeqLock<Payload> lock;
+  std::atomic<bool> stop{false};
+  std::thread writer([&]() {
+    Payload p{};
+    for (uint32_t v = 1U; v <= 20000U; ++v) {
+      p.words.fill(v);
+      p.tail = v;
+      lock.Store(p);
+    }
+    stop.store(true, std::memory_order_release);
+  });
+
+  uint32_t loads = 0U;
+  uint64_t last = 0U;
+  bool torn = false;
+  bool backwards = false;
+  Payload out{};
+  while (!stop.load(std::memory_order_acquire) || loads == 0U) {
+    if (!lock.TryLoad(out)) {
+      continue;
+    }
+    ++loads;
+    for (uint64_t w : out.words) {
+      torn = torn || (w != out.tail);
+    }
+    backwards = backwards || (out.tail < last);
+    last = out.tail;
+  }
+  writer.join();
+  REQUIRE_FALSE(torn);
+  REQUIRE_FALSE(backwards);
+  REQUIRE(lock.Load(out));
+  REQUIRE(out.tail == 20000U);
+  REQUIRE(lock.Version() == 20000U);
+}
+
+// ============================================================================
+// Compact HSM Tests
+// ============================================================================
+
+TEST_CASE("Compact HSM tables follow the hsm-cpp machines", "[compact-hsm]") {
+  fccu::GlobalHsm global;
+  fccu::CompactGlobalHsm compact_global;
+  fccu::PerFaultHsm fault;
+  fccu::CompactFaultHsmArray<1> compact_fault;
+  fault.Bind(0U, 3U);
+
+  uint32_t lcg = 12345U;
+  for (uint32_t i = 0U; i < 2000U; ++i) {
+    lcg = lcg * 1103515245U + 12345U;
+    const uint32_t g_evt = fccu::evt::kFaultReported + (lcg >> 16) % 6U;  // One past the range: ignored
+    REQUIRE(global.Dispatch(g_evt) == compact_global.Dispatch(g_evt));
+    REQUIRE(global.State() == compact_global.State());
+    REQUIRE(global.context().shutdown_requested == compact_global.context().shutdown_requested);
+    if (global.IsShutdown()) {
+      global.Reset();
+      compact_global.Reset();
+    }
+
+    const uint32_t f_evt = fccu::evt::kDetected + (lcg >> 8) % 6U;
+    const uint32_t count = fault.context().occurrence_count + ((f_evt == fccu::evt::kDetected) ? 1U : 0U);
+    REQUIRE(compact_fault.Dispatch(0U, f_evt, count, 3U) == fault.Dispatch(f_evt));
+    REQUIRE(compact_fault.State(0U) == fault.State());
+  }
+  REQUIRE(std::string(compact_global.CurrentStateName()) == global.CurrentStateName());
+}
+
+struct CompactHsmPolicy : fccu::DefaultCollectorPolicy {
+  static constexpr bool kCompactHsm = true;
+  static constexpr bool kSnapshots = true;
+};
+
+TEST_CASE("Compact HSM collector tracks the lifecycle of every fault", "[compact-hsm]") {
+  using CompactCollector = fccu::FaultCollector<256, 64, 4, 0, 1, CompactHsmPolicy>;
+  static CompactCollector c;
+  for (uint32_t i = 0U; i < 200U; ++i) {
+    c.RegisterFault(static_cast<fccu::FaultIndex>(i), 0x2000U + i, 0U, (i % 2U == 0U) ? 1U : 2U);
+  }
+  c.SetDefaultHook(DeferHook);
+
+  for (uint32_t i = 0U; i < 40U; ++i) {
+    c.ReportFault(static_cast<fccu::FaultIndex>(i), i);
+  }
+  REQUIRE(c.GetFaultState(5U) == fccu::FaultState::kDetected);  // kOnReport: detected at report time
+  REQUIRE(c.ProcessFaults() == 40U);
+  REQUIRE(c.GetFaultState(4U) == fccu::FaultState::kActive);    // Threshold 1
+  REQUIRE(c.GetFaultState(5U) == fccu::FaultState::kDetected);  // Threshold 2, one occurrence
+  REQUIRE(c.GetFaultState(150U) == fccu::FaultState::kDormant);
+  REQUIRE(c.GetFaultHsm(4U) == nullptr);
+  REQUIRE(c.GetGlobalHsm().IsActive());
+
+  c.ReportFault(5U, 0U);
+  REQUIRE(c.ProcessFaults() == 1U);
+  REQUIRE(c.GetFaultState(5U) == fccu::FaultState::kActive);
+
+  CompactCollector::StateSnapshot snap;
+  REQUIRE(c.Snapshot(snap));
+  REQUIRE(snap.fault_states[5] == fccu::FaultState::kActive);
+  REQUIRE(snap.fault_states[39] == fccu::FaultState::kDetected);
+
+  c.ClearFault(4U);
+  REQUIRE(c.GetFaultState(4U) == fccu::FaultState::kCleared);
+  c.ClearAllFaults();
+  REQUIRE(c.GetFaultState(5U) == fccu::FaultState::kDormant);
+  REQUIRE(c.GetGlobalHsm().IsIdle());
+}
+
+// ============================================================================
+// Sharded Collector Tests
+// ============================================================================
+
+TEST_CASE("Sharded collector routes by fault index and aggregates shard state", "[sharded]") {
+  using Sharded = fccu::ShardedFaultCollector<2, 16, 8, 4, 2>;
+  static Sharded sc;
+  for (uint32_t i = 0U; i < 8U; ++i) {
+    REQUIRE(sc.RegisterFault(static_cast<fccu::FaultIndex>(i), 0x3000U + i) == fccu::FccuError::kOk);
+  }
+  sc.SetDefaultHook(DeferHook);
+
+  sc.ReportFault(0U, 0U, fccu::FaultPriority::kHigh);
+  sc.ReportFault(1U, 1U, fccu::FaultPriority::kCritical);
+  sc.ReportFault(2U, 2U, fccu::FaultPriority::kLow);
+  sc.ReportFault(3U, 3U, fccu::FaultPriority::kMedium);
+  REQUIRE(sc.GetShard(0U).IsFaultActive(2U));
+  REQUIRE_FALSE(sc.GetShard(1U).IsFaultActive(2U));
+  REQUIRE(sc.ProcessShard(0U) == 2U);
+  REQUIRE(sc.ProcessShard(1U) == 2U);
+
+  Sharded::AggregateState agg;
+  sc.Aggregate(agg);
+  REQUIRE(agg.shards_read == 2U);
+  REQUIRE(agg.active_count == 4U);
+  REQUIRE(agg.stats.total_processed == 4U);
+  REQUIRE(agg.global_state == fccu::GlobalState::kDegraded);  // Critical fault in shard 1
+  REQUIRE(sc.GetGlobalHsm().IsDegraded());
+  REQUIRE(agg.recent_count == 4U);
+  for (uint32_t i = 1U; i < agg.recent_count; ++i) {
+    REQUIRE(agg.recent[i - 1U].timestamp_us >= agg.recent[i].timestamp_us);
+  }
+
+  // Batches are split per shard; errors map back to the caller's order
+  fccu::FaultReport batch[4] = {{4U, 0U, fccu::FaultPriority::kLow},
+                                {5U, 0U, fccu::FaultPriority::kLow},
+                                {40U, 0U, fccu::FaultPriority::kLow},
+                                {6U, 0U, fccu::FaultPriority::kLow}};
+  fccu::FccuError errors[4];
+  fccu::FaultBatchResult r = sc.ReportFaults(batch, 4U, errors);
+  REQUIRE(r.admitted == 3U);
+  REQUIRE(r.rejected == 1U);
+  REQUIRE(errors[2] == fccu::FccuError::kInvalidIndex);
+  REQUIRE(errors[3] == fccu::FccuError::kOk);
+  REQUIRE(sc.GetShard(0U).GetQueueSize(3U) == 2U);
+  REQUIRE(sc.GetShard(1U).GetQueueSize(3U) == 1U);
+}
+
+TEST_CASE("A slow hook only holds up its own shard", "[sharded][concurrency]") {
+  using Sharded = fccu::ShardedFaultCollector<2, 8, 64, 4, 0, 2>;
+  static Sharded sc;
+  static std::atomic<bool> release{false};
+  static std::atomic<bool> slow_entered{false};
+  static std::atomic<uint32_t> fast_seen{0U};
+  static std::atomic<bool> in_order{true};
+  release = false;
+  slow_entered = false;
+  fast_seen = 0U;
+  in_order = true;
+
+  sc.RegisterFault(0U, 0x4000U);
+  sc.RegisterFault(1U, 0x4001U);
+  sc.RegisterHook(0U, [](const fccu::FaultEvent& /*e*/, void* /*ctx*/) -> fccu::HookAction {
+    slow_entered = true;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!release.load() && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();  // Slow diagnostics read
+    }
+    return fccu::HookAction::kHandled;
+  });
+  sc.RegisterHook(1U, [](const fccu::FaultEvent& e, void* /*ctx*/) -> fccu::HookAction {
+    const uint32_t n = fast_seen.load() + 1U;
+    if (e.detail != n || e.occurrence_count != n) {
+      in_order = false;
+    }
+    fast_seen.store(n);
+    return fccu::HookAction::kDefer;
+  });
+
+  std::atomic<bool> stop{false};
+  std::thread workers[2];
+  for (uint32_t w = 0U; w < 2U; ++w) {
+    workers[w] = std::thread([&stop, w]() {
+      while (!stop.load()) {
+        if (sc.ProcessShard(w) == 0U) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  uint8_t lane = 0U;
+  REQUIRE(sc.RegisterProducer(lane) == fccu::FccuError::kOk);
+  sc.ReportFaultFrom(lane, 0U, 0U, fccu::FaultPriority::kCritical);
+  for (uint32_t i = 1U; i <= 50U; ++i) {
+    while (sc.ReportFaultFrom(lane, 1U, i, fccu::FaultPriority::kHigh) != fccu::FccuError::kOk) {
+      std::this_thread::yield();
+    }
+  }
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while ((fast_seen.load() < 50U || !slow_entered.load()) && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::yield();
+  }
+  // Shard 0 must be inside the slow hook, not merely not scheduled yet
+  const bool fast_done_while_blocked = (fast_seen.load() == 50U) && slow_entered.load() && !release.load();
+  release = true;
+  stop = true;
+  for (auto& t : workers) {
+    t.join();
+  }
+  REQUIRE(fast_done_while_blocked);
+  REQUIRE(in_order.load());
+  REQUIRE(sc.GetStatistics().total_processed == 51U);
+}
+
+// ============================================================================
+// Hierarchy Tests
+// ============================================================================
+
+static fccu::HookAction EscalateOnceHook(const fccu::FaultEvent& e, void* /*ctx*/) {
+  return (e.priority == fccu::FaultPriority::kMedium) ? fccu::HookAction::kEscalate : fccu::HookAction::kDefer;
+}
+
+struct UplinkProbe {
+  std::vector<fccu::FaultEvent> events;
+  static fccu::HookAction Hook(const fccu::FaultEvent& e, void* ctx) {
+    static_cast<UplinkProbe*>(ctx)->events.push_back(e);
+    return fccu::HookAction::kDefer;
+  }
+};
+
+TEST_CASE("Children forward first, confirmed and escalated events to the parent", "[hierarchy]") {
+  using Child = fccu::FaultCollector<8, 16, 4, 4>;
+  using Parent = fccu::FaultCollector<8, 16, 4, 4, 3>;
+  Child core0;
+  Child core1;
+  Parent node;
+  UplinkProbe probe;
+  for (uint16_t i = 0U; i < 3U; ++i) {
+    node.RegisterFault(i, 0x5000U + i);
+  }
+  node.SetDefaultHook(UplinkProbe::Hook, &probe);
+  core0.RegisterFault(0U, 0x5000U);
+  core0.RegisterFault(2U, 0x5002U);
+  core0.SetDefaultHook(DeferHook);
+  core0.RegisterHook(2U, EscalateOnceHook);
+  core1.RegisterFault(1U, 0x5001U, 0U, 3U);  // Confirmed on the third report
+  core1.SetDefaultHook(DeferHook);
+
+  fccu::FaultAggregator<Parent> agg(node);
+  uint32_t slot0 = 0U;
+  uint32_t slot1 = 0U;
+  REQUIRE(agg.Attach(core0, slot0) == fccu::FccuError::kOk);
+  REQUIRE(agg.Attach(core1, slot1) == fccu::FccuError::kOk);
+  Child extra;
+  uint32_t slot2 = 0U;
+  REQUIRE(agg.Attach(extra, slot2) == fccu::FccuError::kProducerSlotFull);
+  REQUIRE(agg.ChildCount() == 2U);
+
+  core0.ReportFault(0U, 10U, fccu::FaultPriority::kLow);
+  core0.ReportFault(0U, 11U, fccu::FaultPriority::kLow);  // Repeat: stays local
+  core0.ReportFault(2U, 20U, fccu::FaultPriority::kMedium);
+  for (uint32_t i = 0U; i < 4U; ++i) {
+    core1.ReportFault(1U, 30U + i, fccu::FaultPriority::kHigh);
+  }
+  REQUIRE(core0.ProcessFaults() == 3U);
+  REQUIRE(core1.ProcessFaults() == 4U);
+  REQUIRE(node.GetStatistics().total_reported == 4U);  // 0 first, 2 first + escalated, 1 first, 1 confirmed
+
+  REQUIRE(node.ProcessFaults() == 4U);
+  REQUIRE(probe.events.size() == 4U);
+  REQUIRE(probe.events[0].fault_index == 2U);
+  REQUIRE(probe.events[0].priority == fccu::FaultPriority::kHigh);  // Escalated in the child
+  REQUIRE(probe.events[1].fault_index == 1U);
+  REQUIRE(probe.events[1].detail == 30U);
+  REQUIRE(probe.events[2].detail == 32U);  // Confirmation
+  REQUIRE(probe.events[3].fault_index == 0U);
+  REQUIRE(probe.events[3].detail == 10U);
+
+  // The parent owns the merged view
+  REQUIRE(node.ActiveFaultCount() == 3U);
+  REQUIRE(node.GetGlobalHsm().IsActive());
+  REQUIRE(agg.GetUplinkStats(slot0).forwarded == 2U);
+  REQUIRE(agg.GetUplinkStats(slot1).forwarded == 2U);
+  REQUIRE(agg.GetUplinkStats(slot1).flushes == 1U);
+
+  agg.Detach(slot1);
+  REQUIRE(agg.ChildCount() == 1U);
+  core1.ReportFault(1U, 0U, fccu::FaultPriority::kHigh);
+  core1.ClearFault(1U);
+  core1.ReportFault(1U, 0U, fccu::FaultPriority::kHigh);
+  (void)core1.ProcessFaults();
+  REQUIRE(node.GetStatistics().total_reported == 4U);
+}
+
+TEST_CASE("Child consumers on their own threads feed one parent consumer", "[hierarchy][concurrency]") {
+  using Child = fccu::FaultCollector<64, 64, 4, 0>;
+  using Parent = fccu::FaultCollector<64, 256, 4, 0, 3>;
+  static Child cores[2];
+  static Parent node;
+  static std::atomic<uint32_t> parent_seen{0U};
+  parent_seen = 0U;
+  for (uint16_t i = 0U; i < 64U; ++i) {
+    node.RegisterFault(i, 0x6000U + i);
+    cores[i % 2U].RegisterFault(i, 0x6000U + i);
+  }
+  for (Child& c : cores) {
+    c.SetDefaultHook(HandledHook);
+  }
+  node.SetDefaultHook([](const fccu::FaultEvent&, void*) -> fccu::HookAction {
+    parent_seen.fetch_add(1U, std::memory_order_relaxed);
+    return fccu::HookAction::kHandled;
+  });
+  fccu::FaultAggregator<Parent> agg(node);
+  uint32_t slots[2];
+  REQUIRE(agg.Attach(cores[0], slots[0]) == fccu::FccuError::kOk);
+  REQUIRE(agg.Attach(cores[1], slots[1]) == fccu::FccuError::kOk);
+
+  std::atomic<uint32_t> done{0U};
+  std::thread workers[2];
+  for (uint32_t w = 0U; w < 2U; ++w) {
+    workers[w] = std::thread([w, &done]() {
+      for (uint32_t round = 0U; round < 8U; ++round) {
+        for (uint16_t i = static_cast<uint16_t>(w); i < 64U; i = static_cast<uint16_t>(i + 2U)) {
+          cores[w].ReportFault(i, round);  // Only the first report of each fault goes up
+        }
+        (void)cores[w].ProcessFaults();
+      }
+      done.fetch_add(1U, std::memory_order_release);
+    });
+  }
+  while (done.load(std::memory_order_acquire) < 2U || node.GetQueueSize(2U) != 0U) {
+    (void)node.ProcessFaults();
+  }
+  for (std::thread& t : workers) {
+    t.join();
+  }
+  (void)node.ProcessFaults();
+  REQUIRE(parent_seen.load() == 64U);
+  REQUIRE(agg.GetUplinkStats(slots[0]).forwarded + agg.GetUplinkStats(slots[1]).forwarded == 64U);
+  REQUIRE(agg.GetUplinkStats(slots[0]).dropped == 0U);
+  agg.Detach(slots[0]);
+  agg.Detach(slots[1]);
+}
+
+// ============================================================================
+// Latency Histogram Tests
+// ============================================================================
+
+TEST_CASE("LatencyHistogram buckets and percentiles", "[latency]") {
+  fccu::LatencyHistogram<> h;
+  REQUIRE(h.Count() == 0U);
+  REQUIRE(h.Min() == 0U);
+  REQUIRE(h.P99() == 0U);
+
+  h.Record(0U);
+  REQUIRE(h.BucketCount(0U) == 1U);
+  for (uint32_t i = 0U; i < 98U; ++i) {
+    h.Record(100U);  // Bucket 7: [64, 128)
+  }
+  h.Record(5000U);  // Bucket 13: [4096, 8192)
+
+  REQUIRE(h.Count() == 100U);
+  REQUIRE(h.BucketCount(7U) == 98U);
+  REQUIRE(h.BucketCount(13U) == 1U);
+  REQUIRE(h.Min() == 0U);
+  REQUIRE(h.Max() == 5000U);
+  REQUIRE(h.P50() == 127U);
+  REQUIRE(h.P99() == 127U);
+  REQUIRE(h.P999() == 5000U);  // Capped at Max()
+  REQUIRE(h.ValueAtPermille(1000U) == 5000U);
+
+  h.Record(UINT64_MAX);  // Saturates into the last bucket
+  REQUIRE(h.BucketCount(fccu::LatencyHistogram<>::kBuckets - 1U) == 1U);
+
+  h.Reset();
+  REQUIRE(h.Count() == 0U);
+  REQUIRE(h.Max() == 0U);
+}
+
+struct ManualClock {
+  static constexpr bool kEnabled = true;
+  static inline uint64_t now_ns = 0U;
+  static uint64_t Now() noexcept { return now_ns; }
+  static uint64_t ToNs(uint64_t ticks) noexcept { return ticks; }
+  static uint64_t ToUs(uint64_t ticks) noexcept { return ticks / 1000U; }
+};
+
+struct LatencyPolicy : fccu::DefaultCollectorPolicy {
+  using Clock = ManualClock;
+  static constexpr bool kLatencyHistograms = true;
+};
+
+TEST_CASE("Collector records queue and hook latency per level", "[latency]") {
+  fccu::FaultCollector<16, 8, 4, 4, 1, LatencyPolicy> c;
+  c.RegisterFault(0U, 0x1001U);
+  c.RegisterFault(1U, 0x1002U);
+  c.RegisterHook(0U, [](const fccu::FaultEvent&, void*) -> fccu::HookAction {
+    ManualClock::now_ns += 300U;  // Hook takes 300 ns
+    return fccu::HookAction::kHandled;
+  });
+  c.RegisterHook(1U, HandledHook);
+
+  ManualClock::now_ns = 10000U;
+  c.ReportFault(0U, 0U, fccu::FaultPriority::kCritical);
+  c.ReportFault(1U, 0U, fccu::FaultPriority::kLow);
+  ManualClock::now_ns = 10800U;
+  REQUIRE(c.ProcessFaults() == 2U);
+
+  const auto& crit = c.GetQueueLatency(0U);
+  REQUIRE(crit.Count() == 1U);
+  REQUIRE(crit.Max() == 800U);
+  const auto& low = c.GetQueueLatency(3U);
+  REQUIRE(low.Count() == 1U);
+  REQUIRE(low.Min() == 1100U);  // Waited behind the critical hook
+  REQUIRE(c.GetQueueLatency(1U).Count() == 0U);
+
+  REQUIRE(c.GetHookLatency().Count() == 2U);
+  REQUIRE(c.GetHookLatency().Max() == 300U);
+  REQUIRE(c.GetHookLatency().Min() == 0U);
+
+  c.ResetLatencyHistograms();
+  REQUIRE(c.GetQueueLatency(0U).Count() == 0U);
+  REQUIRE(c.GetHookLatency().Count() == 0U);
+}
+
+// ============================================================================
+// Aging Tests
+// ============================================================================
+
+struct AgingPolicy : fccu::DefaultCollectorPolicy {
+  using Clock = ManualClock;
+  using Aging = fccu::LevelDeadlines<0U, 1000U, 1000U, 5000U>;
+};
+
+struct OrderProbe {
+  std::vector<fccu::FaultIndex> order;
+  static fccu::HookAction Hook(const fccu::FaultEvent& e, void* ctx) {
+    static_cast<OrderProbe*>(ctx)->order.push_back(e.fault_index);
+    return fccu::HookAction::kHandled;
+  }
+};
+
+TEST_CASE("Aging serves entries past their level deadline ahead of higher levels", "[aging]") {
+  fccu::FaultCollector<16, 8, 4, 4, 1, AgingPolicy> c;
+  OrderProbe probe;
+  c.RegisterFault(1U, 0x1001U);
+  c.RegisterFault(3U, 0x1003U);
+  c.SetDefaultHook(OrderProbe::Hook, &probe);
+
+  ManualClock::now_ns = 0U;
+  c.ReportFault(3U, 0U, fccu::FaultPriority::kLow);
+  ManualClock::now_ns = 6000000U;  // 6 ms: past the 5 ms kLow deadline
+  c.ReportFault(1U, 0U, fccu::FaultPriority::kHigh);
+  REQUIRE(c.ProcessFaults() == 2U);
+  REQUIRE(probe.order == std::vector<fccu::FaultIndex>{3U, 1U});
+  REQUIRE(c.GetStatistics().total_aged == 1U);
+
+  // Within its deadline, strict priority still applies
+  probe.order.clear();
+  c.ReportFault(3U, 0U, fccu::FaultPriority::kLow);
+  ManualClock::now_ns += 4000000U;
+  c.ReportFault(1U, 0U, fccu::FaultPriority::kHigh);
+  REQUIRE(c.ProcessFaults() == 2U);
+  REQUIRE(probe.order == std::vector<fccu::FaultIndex>{1U, 3U});
+  REQUIRE(c.GetStatistics().total_aged == 1U);
+}
+
+// ============================================================================
+// Deferred Re-check Tests
+// ============================================================================
+
+TEST_CASE("TimerWheel fires due timers, laps and tolerates cancel from a callback", "[timer]") {
+  fccu::TimerWheel<8, 16> wheel;
+  std::vector<uint16_t> fired;
+  wheel.Schedule(1U, 3U);
+  wheel.Schedule(2U, 3U + 8U);  // Same slot, one lap later
+  wheel.Schedule(3U, 5U);
+  wheel.Schedule(4U, 5U);
+  REQUIRE(wheel.Pending() == 4U);
+
+  REQUIRE(wheel.Advance(2U, [&](uint16_t id) { fired.push_back(id); }) == 0U);
+  REQUIRE(wheel.Advance(4U, [&](uint16_t id) { fired.push_back(id); }) == 1U);
+  REQUIRE(fired == std::vector<uint16_t>{1U});
+
+  // Firing 4 cancels 3 (its list neighbour) and re-arms itself
+  fired.clear();
+  REQUIRE(wheel.Advance(5U, [&](uint16_t id) {
+    fired.push_back(id);
+    (void)wheel.Cancel(3U);
+    wheel.Schedule(id, 7U);
+  }) == 1U);
+  REQUIRE(fired == std::vector<uint16_t>{4U});
+  REQUIRE_FALSE(wheel.IsScheduled(3U));
+  REQUIRE(wheel.Expiry(4U) == 7U);
+
+  // A jump past a full lap still fires everything due
+  fired.clear();
+  REQUIRE(wheel.Advance(100U, [&](uint16_t id) { fired.push_back(id); }) == 2U);
+  REQUIRE(wheel.Pending() == 0U);
+  wheel.Schedule(5U, 50U);  // In the past: next tick
+  REQUIRE(wheel.Expiry(5U) == 101U);
+  wheel.Clear();
+  REQUIRE(wheel.Pending() == 0U);
+}
+
+using DeferTestClock = fccu::BasicTickClock<struct DeferTestTag>;
+
+struct DeferPolicy : fccu::DefaultCollectorPolicy {
+  using Clock = DeferTestClock;
+  using DeferTimer = fccu::DeferTimerWheel<16U, 1000U>;
+};
+
+/** @brief Hook that asks its collector for a 5 ms re-check until call handle_on_call. */
+template <typename Collector>
+struct RecheckProbe {
+  Collector* collector = nullptr;
+  uint32_t calls = 0U;
+  uint32_t rechecks = 0U;
+  uint32_t handle_on_call = 3U;  ///< Call number that returns kHandled
+  fccu::FaultEvent last{};
+  static fccu::HookAction Hook(const fccu::FaultEvent& e, void* ctx) {
+    auto* p = static_cast<RecheckProbe*>(ctx);
+    ++p->calls;
+    p->rechecks += e.is_recheck ? 1U : 0U;
+    p->last = e;
+    if (p->calls >= p->handle_on_call) {
+      return fccu::HookAction::kHandled;
+    }
+    (void)p->collector->RequestRecheck(e.fault_index, 5000U);
+    return fccu::HookAction::kDefer;
+  }
+};
+
+TEST_CASE("RequestRecheck re-runs the hook at its deadline without queueing", "[defer]") {
+  using Collector = fccu::FaultCollector<16, 8, 4, 4, 1, DeferPolicy>;
+  Collector c;
+  RecheckProbe<Collector> probe{&c};
+  c.RegisterFault(2U, 0x2002U);
+  c.RegisterHook(2U, RecheckProbe<Collector>::Hook, &probe);
+
+  DeferTestClock::Set(100000U);
+  c.ReportFault(2U, 77U, fccu::FaultPriority::kHigh);
+  REQUIRE(c.ProcessFaults() == 1U);
+  REQUIRE(probe.calls == 1U);
+  REQUIRE(c.IsFaultActive(2U));
+  REQUIRE(c.PendingRecheckCount() == 1U);
+
+  DeferTestClock::Advance(4000U);  // Not due yet
+  (void)c.ProcessFaults();
+  REQUIRE(probe.calls == 1U);
+
+  DeferTestClock::Advance(1000U);
+  REQUIRE(c.ProcessFaults() == 0U);  // No entry was queued for the re-check
+  REQUIRE(probe.calls == 2U);
+  REQUIRE(probe.last.is_recheck);
+  REQUIRE(probe.last.detail == 77U);
+  REQUIRE(probe.last.priority == fccu::FaultPriority::kHigh);
+  REQUIRE(probe.last.timestamp_us == 100000U);  // Original report time
+  REQUIRE(probe.last.coalesced_count == 0U);
+  REQUIRE(probe.last.occurrence_count == 1U);
+
+  DeferTestClock::Advance(5000U);
+  (void)c.ProcessFaults();
+  REQUIRE(probe.calls == 3U);  // kHandled this time
+  REQUIRE_FALSE(c.IsFaultActive(2U));
+  REQUIRE(c.PendingRecheckCount() == 0U);
+
+  auto stats = c.GetStatistics();
+  REQUIRE(stats.total_rechecked == 2U);
+  REQUIRE(stats.total_processed == 1U);
+}
+
+TEST_CASE("A new report or ClearFault supersedes a pending re-check", "[defer]") {
+  using Collector = fccu::FaultCollector<16, 8, 4, 4, 1, DeferPolicy>;
+  Collector c;
+  RecheckProbe<Collector> probe{&c};
+  probe.handle_on_call = 100U;
+  c.RegisterFault(1U, 0x2001U);
+  c.RegisterHook(1U, RecheckProbe<Collector>::Hook, &probe);
+
+  DeferTestClock::Set(0U);
+  c.ReportFault(1U, 1U);
+  REQUIRE(c.ProcessFaults() == 1U);
+  DeferTestClock::Advance(3000U);
+  c.ReportFault(1U, 2U);  // Re-arms the timer from now
+  REQUIRE(c.ProcessFaults() == 1U);
+  REQUIRE(c.PendingRecheckCount() == 1U);
+
+  DeferTestClock::Advance(3000U);  // First deadline passed, the re-armed one not
+  (void)c.ProcessFaults();
+  REQUIRE(probe.calls == 2U);
+  REQUIRE(probe.rechecks == 0U);
+
+  DeferTestClock::Advance(2000U);
+  (void)c.ProcessFaults();
+  REQUIRE(probe.rechecks == 1U);
+  REQUIRE(probe.last.detail == 2U);
+
+  c.ClearFault(1U);
+  REQUIRE(c.PendingRecheckCount() == 0U);
+  DeferTestClock::Advance(10000U);
+  (void)c.ProcessFaults();
+  REQUIRE(probe.calls == 3U);
+}
+
+TEST_CASE("Sharded statistics sum re-checks over all shards", "[defer][sharded]") {
+  using Sharded = fccu::ShardedFaultCollector<2, 16, 8, 4, 4, 1, DeferPolicy>;
+  static Sharded sc;
+  RecheckProbe<Sharded> probes[2];
+  for (uint16_t i = 0U; i < 2U; ++i) {
+    probes[i].collector = &sc;
+    probes[i].handle_on_call = 2U;
+    sc.RegisterFault(i, 0x2100U + i);
+    sc.RegisterHook(i, RecheckProbe<Sharded>::Hook, &probes[i]);
+  }
+
+  DeferTestClock::Set(0U);
+  sc.ReportFault(0U);
+  sc.ReportFault(1U);
+  REQUIRE(sc.ProcessShard(0U) == 1U);
+  REQUIRE(sc.ProcessShard(1U) == 1U);
+  DeferTestClock::Advance(5000U);
+  (void)sc.ProcessShard(0U);
+  (void)sc.ProcessShard(1U);
+  REQUIRE(probes[0].rechecks == 1U);
+  REQUIRE(probes[1].rechecks == 1U);
+
+  REQUIRE(sc.GetStatistics().total_rechecked == 2U);
+  Sharded::AggregateState agg;
+  sc.Aggregate(agg);
+  REQUIRE(agg.stats.total_rechecked == 2U);
+  REQUIRE(sc.ActiveFaultCount() == 0U);
+}
+
+TEST_CASE("RequestRecheck only applies to the running hook's fault and a kept verdict", "[defer]") {
+  using Collector = fccu::FaultCollector<16, 8, 4, 4, 1, DeferPolicy>;
+  static Collector c;
+  static fccu::FccuError other_fault = fccu::FccuError::kOk;
+  c.RegisterFault(0U, 0x2000U);
+  c.RegisterFault(1U, 0x2001U);
+  // Fault 0 asks for fault 1 and itself, then reports itself handled
+  c.RegisterHook(0U, [](const fccu::FaultEvent& e, void*) -> fccu::HookAction {
+    other_fault = c.RequestRecheck(1U, 1000U);
+    (void)c.RequestRecheck(e.fault_index, 1000U);
+    return fccu::HookAction::kHandled;
+  });
+  c.RegisterHook(1U, [](const fccu::FaultEvent& e, void*) -> fccu::HookAction {
+    (void)c.RequestRecheck(e.fault_index, 1000U);
+    return fccu::HookAction::kEscalate;  // Climbs to kCritical, then stays active
+  });
+
+  REQUIRE(c.RequestRecheck(0U, 1000U) == fccu::FccuError::kInvalidIndex);  // No hook running
+  DeferTestClock::Set(0U);
+  c.ReportFault(0U);
+  c.ReportFault(1U, 0U, fccu::FaultPriority::kLow);
+  REQUIRE(c.ProcessFaults() == 2U);
+  REQUIRE(other_fault == fccu::FccuError::kInvalidIndex);
+  REQUIRE_FALSE(c.IsFaultActive(0U));
+  REQUIRE(c.IsFaultActive(1U));
+  REQUIRE(c.PendingRecheckCount() == 1U);  // Only fault 1
+
+  DeferTestClock::Advance(1000U);
+  (void)c.ProcessFaults();
+  REQUIRE(c.GetStatistics().total_rechecked == 1U);
+  c.ClearAllFaults();
+}
+
+TEST_CASE("RequestRecheck without Policy::DeferTimer leaves plain kDefer", "[defer]") {
+  using Collector = fccu::FaultCollector<16, 8, 4, 4>;
+  Collector c;
+  RecheckProbe<Collector> probe{&c};
+  c.RegisterFault(0U, 0x2000U);
+  c.RegisterHook(0U, RecheckProbe<Collector>::Hook, &probe);
+  c.ReportFault(0U);
+  REQUIRE(c.ProcessFaults() == 1U);
+  REQUIRE(c.IsFaultActive(0U));
+  REQUIRE(c.PendingRecheckCount() == 0U);
+}
+
+// A verdict is one of the four enumerators again: plain comparisons and switches keep working
+static_assert(sizeof(fccu::HookAction) == 1U, "HookAction keeps its uint8_t underlying type");
+
+// ============================================================================
+// Packed Entry Tests
+// ============================================================================
+
+TEST_CASE("PackedFaultEntry round-trips index, owner flag and widened timestamp", "[packed]") {
+  fccu::FaultEntry e{};
+  e.fault_index = 0x7FFEU;
+  e.priority = fccu::FaultPriority::kHigh;
+  e.reserved = fccu::kEntryCoalesceOwner;
+  e.detail = 0x12345678U;
+  const uint64_t epoch = 1000U;
+  e.timestamp = epoch + 0x1FFFFFF00ULL;  // Delta past 2^32: only the low 32 bits are stored
+
+  auto p = fccu::PackedFaultEntry::Encode(e, epoch);
+  fccu::FaultEntry d = p.Decode(fccu::FaultPriority::kHigh, epoch, e.timestamp + 500U);
+  REQUIRE(d.fault_index == 0x7FFEU);
+  REQUIRE(d.reserved == fccu::kEntryCoalesceOwner);
+  REQUIRE(d.priority == fccu::FaultPriority::kHigh);
+  REQUIRE(d.detail == 0x5678U);
+  REQUIRE(d.timestamp == e.timestamp);
+
+  // The consumer clock may trail the producer's slightly
+  REQUIRE(p.Timestamp(epoch, e.timestamp - 20U) == e.timestamp);
+}
+
+struct PackedPolicy : fccu::DefaultCollectorPolicy {
+  using Clock = ManualClock;
+  using Entry = fccu::PackedFaultEntry;
+  static constexpr bool kCoalescing = true;
+};
+
+TEST_CASE("Packed entries halve queue memory and deliver the same events", "[packed]") {
+  using Packed = fccu::FaultCollector<16, 64, 4, 4, 1, PackedPolicy>;
+  using Wide = fccu::FaultCollector<16, 64, 4, 4, 1, CoalescePolicy>;
+  static_assert(sizeof(Packed::QueueEntry) == 8U, "Packed queue entry");
+  REQUIRE(sizeof(Packed) + 4U * 64U * 8U <= sizeof(Wide));
+
+  Packed c;
+  CoalesceProbe probe;
+  for (uint16_t i = 0U; i < 4U; ++i) {
+    c.RegisterFault(i, 0x1000U + i);
+    c.RegisterHook(i, CoalesceProbeHook, &probe);
+  }
+  c.SetCoalescing(3U);
+
+  ManualClock::now_ns = 5000000U;
+  c.ReportFault(0U, 10U, fccu::FaultPriority::kLow);
+  c.ReportFault(3U, 1U, fccu::FaultPriority::kMedium);
+  c.ReportFault(3U, 2U, fccu::FaultPriority::kMedium);  // Coalesced onto the owner entry
+  fccu::FaultReport batch[] = {{1U, 11U, fccu::FaultPriority::kHigh}, {2U, 12U, fccu::FaultPriority::kCritical}};
+  REQUIRE(c.ReportFaults(batch, 2U).admitted == 2U);
+
+  ManualClock::now_ns = 7000000U;
+  REQUIRE(c.ProcessFaults() == 4U);
+  REQUIRE(probe.events == 4U);
+  REQUIRE(probe.reports == 5U);
+  REQUIRE(probe.last.fault_index == 0U);  // kLow is processed last
+  REQUIRE(probe.last.priority == fccu::FaultPriority::kLow);
+  REQUIRE(probe.last.detail == 10U);
+  REQUIRE(probe.last.timestamp_us == 5000U);
+  REQUIRE(c.ActiveFaultCount() == 0U);
+}
+
+// ============================================================================
+// FaultQueueSet Standalone Tests
+// ============================================================================
+
+TEST_CASE("FaultQueueSet basic push/pop", "[queue]") {
+  fccu::FaultQueueSet<fccu::FaultEntry, 4, 8> qs;
+
+  fccu::FaultEntry entry{};
+  entry.fault_index = 5U;
+  entry.priority = fccu::FaultPriority::kHigh;
+
+  REQUIRE(qs.Push(1U, entry));
+  REQUIRE_FALSE(qs.IsEmpty());
+  REQUIRE(qs.TotalSize() == 1U);
+
+  fccu::FaultEntry out{};
+  uint8_t level = 0U;
+  REQUIRE(qs.Pop(out, level));
+  REQUIRE(out.fault_index == 5U);
+  REQUIRE(level == 1U);
+  REQUIRE(qs.IsEmpty());
+}
 
 TEST_CASE("FaultQueueSet priority ordering", "[queue]") {
   fccu::FaultQueueSet<fccu::FaultEntry, 4, 8> qs;
@@ -493,6 +2674,129 @@ TEST_CASE("FaultQueueSet admission control", "[queue]") {
   REQUIRE(qs.PushWithAdmission(0U, entry));
 }
 
+TEST_CASE("FaultQueueSet bulk pop takes highest level first", "[queue]") {
+  fccu::FaultQueueSet<fccu::FaultEntry, 4, 8> qs;
+  fccu::FaultEntry entry{};
+  for (uint16_t i = 0U; i < 3U; ++i) {
+    entry.fault_index = i;
+    qs.Push(2U, entry);
+  }
+  entry.fault_index = 7U;
+  qs.Push(1U, entry);
+
+  fccu::FaultEntry out[8];
+  uint8_t level = 0U;
+  REQUIRE(qs.PopBatch(out, 8U, level) == 1U);
+  REQUIRE(level == 1U);
+  REQUIRE(out[0].fault_index == 7U);
+  REQUIRE(qs.PopBatch(out, 2U, level) == 2U);
+  REQUIRE(level == 2U);
+  REQUIRE(out[1].fault_index == 1U);
+  REQUIRE(qs.PopBatch(out, 8U, level) == 1U);
+  REQUIRE(qs.PopBatch(out, 8U, level) == 0U);
+}
+
+TEST_CASE("FaultQueueSet overdue pop skips the highest non-empty level", "[queue]") {
+  fccu::FaultQueueSet<fccu::FaultEntry, 4, 8> qs;
+  fccu::FaultEntry entry{};
+  entry.fault_index = 1U;
+  qs.Push(0U, entry);
+  for (uint16_t i = 10U; i < 13U; ++i) {
+    entry.fault_index = i;
+    entry.timestamp = (i < 12U) ? 0U : 100U;  // Two old, one young
+    qs.Push(2U, entry);
+  }
+  auto is_due = [](const fccu::FaultEntry& e, uint8_t /*level*/) { return e.timestamp == 0U; };
+
+  fccu::FaultEntry out[8];
+  uint8_t level = 0U;
+  REQUIRE(qs.PopOverdueBatch(out, 8U, level, is_due) == 2U);
+  REQUIRE(level == 2U);
+  REQUIRE(out[1].fault_index == 11U);
+  REQUIRE(qs.PopOverdueBatch(out, 8U, level, is_due) == 0U);  // Head is young now
+  REQUIRE(qs.PopBatch(out, 8U, level) == 1U);
+  REQUIRE(level == 0U);
+  REQUIRE(qs.PopBatch(out, 8U, level) == 1U);
+  REQUIRE(out[0].fault_index == 12U);
+}
+
+TEST_CASE("FaultQueueSet overdue pop rotates over lanes", "[queue]") {
+  fccu::FaultQueueSet<fccu::FaultEntry, 4, 8, 3> qs;
+  fccu::FaultEntry entry{};
+  entry.fault_index = 1U;
+  qs.Push(0U, entry);  // Keeps level 0 non-empty, so level 2 is aged
+  for (uint8_t lane = 0U; lane < 3U; ++lane) {
+    for (uint16_t i = 0U; i < 4U; ++i) {
+      entry.fault_index = static_cast<uint16_t>(lane * 10U + i);
+      qs.Push(lane, 2U, entry);
+    }
+  }
+  auto is_due = [](const fccu::FaultEntry& /*e*/, uint8_t /*level*/) { return true; };
+
+  // Blocks of 2: lane 0 is still backed up, yet every lane gets its turn
+  fccu::FaultEntry out[2];
+  uint8_t level = 0U;
+  std::vector<uint16_t> firsts;
+  for (uint32_t i = 0U; i < 6U; ++i) {
+    REQUIRE(qs.PopOverdueBatch(out, 2U, level, is_due) == 2U);
+    REQUIRE(level == 2U);
+    firsts.push_back(out[0].fault_index);
+  }
+  REQUIRE(firsts == std::vector<uint16_t>{0U, 10U, 20U, 2U, 12U, 22U});
+}
+
+TEST_CASE("FaultQueueSet non-empty mask tracks levels", "[queue]") {
+  fccu::FaultQueueSet<fccu::FaultEntry, 4, 8> qs;
+  REQUIRE(qs.NonEmptyMask() == 0U);
+
+  fccu::FaultEntry entry{};
+  qs.Push(3U, entry);
+  qs.Push(1U, entry);
+  REQUIRE(qs.NonEmptyMask() == 0x0AU);
+
+  fccu::FaultEntry out{};
+  uint8_t level = 0U;
+  REQUIRE(qs.Pop(out, level));
+  REQUIRE(level == 1U);
+  REQUIRE(qs.Pop(out, level));
+  REQUIRE(level == 3U);
+  REQUIRE(qs.IsEmpty());
+
+  // Stale bits are settled by the next empty poll
+  REQUIRE_FALSE(qs.Pop(out, level));
+  REQUIRE(qs.NonEmptyMask() == 0U);
+}
+
+TEST_CASE("FaultQueueSet concurrent producers never strand items", "[queue][producer]") {
+  fccu::FaultQueueSet<fccu::FaultEntry, 4, 16, 2> qs;
+  constexpr uint32_t kPerProducer = 20000U;
+
+  std::vector<std::thread> producers;
+  for (uint8_t p = 0U; p < 2U; ++p) {
+    producers.emplace_back([&qs, p]() {
+      fccu::FaultEntry entry{};
+      for (uint32_t n = 0U; n < kPerProducer;) {
+        if (qs.Push(p, static_cast<uint8_t>(n % 4U), entry)) {
+          ++n;
+        }
+      }
+    });
+  }
+
+  uint32_t received = 0U;
+  fccu::FaultEntry out[8];
+  uint8_t level = 0U;
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (received < 2U * kPerProducer && std::chrono::steady_clock::now() < deadline) {
+    received += static_cast<uint32_t>(qs.PopBatch(out, 8U, level));
+  }
+  for (auto& t : producers) {
+    t.join();
+  }
+  REQUIRE(received == 2U * kPerProducer);
+  REQUIRE(qs.IsEmpty());
+}
+
 TEST_CASE("FaultQueueSet invalid level", "[queue]") {
   fccu::FaultQueueSet<fccu::FaultEntry, 4, 8> qs;
   fccu::FaultEntry entry{};
@@ -500,6 +2804,58 @@ TEST_CASE("FaultQueueSet invalid level", "[queue]") {
   REQUIRE_FALSE(qs.Push(255U, entry));
 }
 
+TEST_CASE("FaultQueueSet producer lanes", "[queue]") {
+  fccu::FaultQueueSet<fccu::FaultEntry, 4, 8, 3> qs;
+  REQUIRE(decltype(qs)::kClaimableLanes == 2U);
+
+  uint8_t lane_a = 0U;
+  uint8_t lane_b = 0U;
+  uint8_t lane_c = 0U;
+  REQUIRE(qs.RegisterProducer(lane_a));
+  REQUIRE(qs.RegisterProducer(lane_b));
+  REQUIRE(lane_a != lane_b);
+  REQUIRE(lane_a != 0U);  // Lane 0 belongs to the lane-less Push()
+  REQUIRE(lane_b != 0U);
+  REQUIRE_FALSE(qs.RegisterProducer(lane_c));
+  REQUIRE(lane_c == decltype(qs)::kInvalidLane);
+  REQUIRE(qs.ProducerCount() == 2U);
+
+  fccu::FaultEntry entry{};
+  entry.fault_index = 1U;
+  REQUIRE(qs.Push(lane_a, 2U, entry));
+  entry.fault_index = 2U;
+  REQUIRE(qs.Push(lane_b, 2U, entry));
+  entry.fault_index = 3U;
+  REQUIRE(qs.Push(lane_b, 0U, entry));
+  REQUIRE(qs.Size(2U) == 2U);
+  REQUIRE(qs.Size(lane_b, 2U) == 1U);
+
+  // Highest level first, then both lanes of level 2
+  fccu::FaultEntry out{};
+  uint8_t level = 0U;
+  REQUIRE(qs.Pop(out, level));
+  REQUIRE(out.fault_index == 3U);
+  REQUIRE(level == 0U);
+  REQUIRE(qs.Pop(out, level));
+  REQUIRE(qs.Pop(out, level));
+  REQUIRE(level == 2U);
+  REQUIRE(qs.IsEmpty());
+
+  qs.ReleaseProducer(lane_a);
+  REQUIRE(qs.RegisterProducer(lane_c));
+  REQUIRE(lane_c == lane_a);
+}
+
+TEST_CASE("FaultQueueSet admission is per lane", "[queue]") {
+  fccu::FaultQueueSet<fccu::FaultEntry, 4, 8, 2> qs;
+  fccu::FaultEntry entry{};
+  for (int i = 0; i < 5; ++i) {
+    qs.Push(0U, 3U, entry);
+  }
+  REQUIRE_FALSE(qs.PushWithAdmission(0U, 3U, entry));
+  REQUIRE(qs.PushWithAdmission(1U, 3U, entry));
+}
+
 // ============================================================================
 // Global HSM Standalone Tests
 // ============================================================================
@@ -0,0 +1,89 @@
+/**
+ * @file fccu_recorder_dump.cpp
+ * @brief Decode a FaultRecorder ring file (fault_recorder.hpp) for post-mortem analysis.
+ *
+ * Usage: fccu_recorder_dump FILE [--csv]
+ *   --csv  One comma-separated line per record (with a header line)
+ *
+ * Records are printed oldest first. Torn or overwritten slots are skipped
+ * and counted on stderr; the exit status is non-zero if the file is not a
+ * valid recorder region.
+ */
+
+#include "fccu/fault_recorder.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+int main(int argc, char** argv) {
+  const char* path = nullptr;
+  bool csv = false;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--csv") == 0) {
+      csv = true;
+    } else if (path == nullptr && argv[i][0] != '-') {
+      path = argv[i];
+    } else {
+      path = nullptr;
+      break;
+    }
+  }
+  if (path == nullptr) {
+    std::fprintf(stderr, "usage: %s FILE [--csv]\n", argv[0]);
+    return 2;
+  }
+
+  int fd = open(path, O_RDONLY);
+  struct stat st {};
+  if (fd < 0 || fstat(fd, &st) != 0 || st.st_size <= 0) {
+    std::fprintf(stderr, "%s: cannot open\n", path);
+    return 1;
+  }
+  const auto size = static_cast<uint64_t>(st.st_size);
+  void* mem = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  (void)close(fd);
+  if (mem == MAP_FAILED) {
+    std::fprintf(stderr, "%s: cannot map\n", path);
+    return 1;
+  }
+
+  const auto& header = *static_cast<const fccu::RecorderHeader*>(mem);
+  if (size < sizeof(header) || !fccu::detail::HeaderValid(header, size)) {
+    std::fprintf(stderr, "%s: not a fault recorder file (version %u expected)\n", path, fccu::kRecorderVersion);
+    (void)munmap(mem, size);
+    return 1;
+  }
+
+  if (csv) {
+    std::printf("seq,timestamp_us,fault_index,fault_code,priority,detail,occurrence_count,coalesced_count,first\n");
+  } else {
+    std::printf("# capacity=%u committed_seq=%llu\n", header.capacity,
+                static_cast<unsigned long long>(header.committed_seq));  // NOLINT(runtime/int)
+  }
+  uint32_t skipped = 0U;
+  uint32_t n = fccu::ForEachRecorded(
+      mem, size,
+      [csv](const fccu::RecordedFault& rec) {
+        const auto seq = static_cast<unsigned long long>(rec.seq);          // NOLINT(runtime/int)
+        const auto ts = static_cast<unsigned long long>(rec.timestamp_us);  // NOLINT(runtime/int)
+        const unsigned first = (rec.flags & fccu::kRecordFirst) ? 1U : 0U;
+        if (csv) {
+          std::printf("%llu,%llu,%u,0x%04x,%u,0x%x,%u,%u,%u\n", seq, ts, rec.fault_index, rec.fault_code,
+                      rec.priority, rec.detail, rec.occurrence_count, rec.coalesced_count, first);
+        } else {
+          std::printf("#%-8llu %14llu us  fault=%-5u code=0x%04x pri=%u detail=0x%x count=%u%s%s\n", seq, ts,
+                      rec.fault_index, rec.fault_code, rec.priority, rec.detail, rec.occurrence_count,
+                      (rec.coalesced_count > 1U) ? " coalesced" : "", first ? " FIRST" : "");
+        }
+      },
+      &skipped);
+  std::fprintf(stderr, "%u record(s), %u skipped\n", n, skipped);
+  (void)munmap(mem, size);
+  return 0;
+}
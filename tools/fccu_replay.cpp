@@ -0,0 +1,343 @@
+/**
+ * @file fccu_replay.cpp
+ * @brief Replay a recorded fault storm against FaultCollector (regression load generator).
+ *
+ * Usage: fccu_replay TRACE [--speed X | --max] [--producers N] [--out FILE] [--max-drops N]
+ *   TRACE          FaultRecorder ring file (fault_recorder.hpp), or CSV text with a header
+ *                  naming the columns timestamp_us, fault_index, detail, priority
+ *                  (fccu_recorder_dump --csv output works as-is)
+ *   --speed X      Replay X times faster than recorded (default: 1 = original pacing)
+ *   --max          No pacing: report as fast as possible
+ *   --producers N  Producer threads (1..8, default: 1); faults are split by index so
+ *                  each fault keeps its recorded order
+ *   --out FILE     Also write results as JSON (same schema as fccu_bench)
+ *   --max-drops N  Exit with status 3 if more than N reports were dropped
+ *
+ * Reports per-priority drops, per-level queue high-water marks (sampled by
+ * the consumer before every ProcessFaults() call) and report-to-process
+ * latency percentiles. The collector geometry below should match the
+ * deployment being validated.
+ */
+
+#include "fccu/fault_recorder.hpp"
+#include "fccu/fccu.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// ============================================================================
+// Replay Collector
+// ============================================================================
+
+constexpr uint32_t kFaults = 1024U;
+constexpr uint32_t kDepth = 256U;
+constexpr uint32_t kLevels = 4U;
+constexpr uint32_t kMaxProducers = 9U;  // Lane 0 stays unclaimed: 8 producer lanes
+
+struct ReplayPolicy : fccu::DefaultCollectorPolicy {
+  static constexpr bool kLatencyHistograms = true;
+};
+
+using ReplayCollector = fccu::FaultCollector<kFaults, kDepth, kLevels, 0U, kMaxProducers, ReplayPolicy>;
+
+fccu::HookAction HandledHook(const fccu::FaultEvent& /*e*/, void* /*ctx*/) { return fccu::HookAction::kHandled; }
+
+uint64_t NowNs() noexcept {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+// ============================================================================
+// Trace Loading
+// ============================================================================
+
+struct TraceEntry {
+  uint64_t timestamp_us;
+  uint32_t detail;
+  fccu::FaultIndex fault_index;
+  fccu::FaultPriority priority;
+};
+
+fccu::FaultPriority ToPriority(unsigned long v) noexcept {  // NOLINT(runtime/int)
+  return static_cast<fccu::FaultPriority>((v < kLevels) ? v : kLevels - 1U);
+}
+
+bool LoadRecorderFile(const char* path, std::vector<TraceEntry>& out) {
+  int fd = open(path, O_RDONLY);
+  struct stat st {};
+  if (fd < 0 || fstat(fd, &st) != 0 || static_cast<uint64_t>(st.st_size) < sizeof(fccu::RecorderHeader)) {
+    if (fd >= 0) {
+      (void)close(fd);
+    }
+    return false;
+  }
+  const auto size = static_cast<uint64_t>(st.st_size);
+  void* mem = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  (void)close(fd);
+  if (mem == MAP_FAILED) {
+    return false;
+  }
+  bool ok = fccu::detail::HeaderValid(*static_cast<const fccu::RecorderHeader*>(mem), size);
+  if (ok) {
+    fccu::ForEachRecorded(mem, size, [&out](const fccu::RecordedFault& rec) {
+      out.push_back(TraceEntry{rec.timestamp_us, rec.detail, rec.fault_index, ToPriority(rec.priority)});
+    });
+  }
+  (void)munmap(mem, size);
+  return ok;
+}
+
+/** @brief CSV with a header line; columns are located by name, extra columns ignored. */
+bool LoadCsvFile(const char* path, std::vector<TraceEntry>& out) {
+  FILE* f = std::fopen(path, "r");
+  if (f == nullptr) {
+    return false;
+  }
+  std::array<int, 4> col{-1, -1, -1, -1};  // timestamp_us, fault_index, detail, priority
+  static const char* const kNames[4] = {"timestamp_us", "fault_index", "detail", "priority"};
+  char line[512];
+  bool have_header = false;
+  while (std::fgets(line, sizeof(line), f) != nullptr) {
+    if (line[0] == '#' || line[0] == '\n') {
+      continue;
+    }
+    std::array<char*, 16> fields{};
+    int n = 0;
+    for (char* tok = std::strtok(line, ",\r\n"); tok != nullptr && n < 16; tok = std::strtok(nullptr, ",\r\n")) {
+      fields[n++] = tok;
+    }
+    if (!have_header) {
+      for (int i = 0; i < n; ++i) {
+        for (int k = 0; k < 4; ++k) {
+          if (std::strcmp(fields[i], kNames[k]) == 0) {
+            col[k] = i;
+          }
+        }
+      }
+      if (col[1] < 0) {
+        std::fprintf(stderr, "%s: CSV header must name at least fault_index\n", path);
+        (void)std::fclose(f);
+        return false;
+      }
+      have_header = true;
+      continue;
+    }
+    auto field = [&](int k) -> unsigned long long {  // NOLINT(runtime/int)
+      return (col[k] >= 0 && col[k] < n) ? std::strtoull(fields[col[k]], nullptr, 0) : 0U;
+    };
+    out.push_back(TraceEntry{field(0), static_cast<uint32_t>(field(2)), static_cast<fccu::FaultIndex>(field(1)),
+                             ToPriority(static_cast<unsigned long>(field(3)))});  // NOLINT(runtime/int)
+  }
+  (void)std::fclose(f);
+  return have_header;
+}
+
+// ============================================================================
+// Results
+// ============================================================================
+
+class ReplayReport {
+ public:
+  void Add(const std::string& name, double value, const char* unit) {
+    results_.push_back(Result{name, value, unit});
+    std::printf("  %-40s %14.2f %s\n", name.c_str(), value, unit);
+  }
+
+  bool WriteJson(const char* path) const {
+    FILE* f = std::fopen(path, "w");
+    if (f == nullptr) {
+      return false;
+    }
+    std::fprintf(f, "{\n  \"schema\": 1,\n  \"tool\": \"fccu_replay\",\n  \"results\": [\n");
+    for (size_t i = 0U; i < results_.size(); ++i) {
+      const Result& r = results_[i];
+      std::fprintf(f, "    {\"name\": \"%s\", \"value\": %.3f, \"unit\": \"%s\"}%s\n", r.name.c_str(), r.value, r.unit,
+                   (i + 1U < results_.size()) ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+    return std::fclose(f) == 0;
+  }
+
+ private:
+  struct Result {
+    std::string name;
+    double value;
+    const char* unit;
+  };
+  std::vector<Result> results_;
+};
+
+struct ReplayConfig {
+  double speed = 1.0;  ///< 0 = max speed
+  uint32_t producers = 1U;
+  const char* out_path = nullptr;
+  long long max_drops = -1;  // NOLINT(runtime/int)
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const char* trace_path = nullptr;
+  ReplayConfig cfg;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--speed") == 0 && i + 1 < argc) {
+      cfg.speed = std::strtod(argv[++i], nullptr);
+    } else if (std::strcmp(argv[i], "--max") == 0) {
+      cfg.speed = 0.0;
+    } else if (std::strcmp(argv[i], "--producers") == 0 && i + 1 < argc) {
+      cfg.producers = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 0));
+    } else if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+      cfg.out_path = argv[++i];
+    } else if (std::strcmp(argv[i], "--max-drops") == 0 && i + 1 < argc) {
+      cfg.max_drops = std::strtoll(argv[++i], nullptr, 0);
+    } else if (trace_path == nullptr && argv[i][0] != '-') {
+      trace_path = argv[i];
+    } else {
+      trace_path = nullptr;
+      break;
+    }
+  }
+  if (trace_path == nullptr || cfg.producers == 0U || cfg.producers > ReplayCollector::kClaimableLanes ||
+      cfg.speed < 0.0) {
+    std::fprintf(stderr, "usage: %s TRACE [--speed X | --max] [--producers 1..%u] [--out FILE] [--max-drops N]\n",
+                 argv[0], ReplayCollector::kClaimableLanes);
+    return 2;
+  }
+
+  std::vector<TraceEntry> trace;
+  if (!LoadRecorderFile(trace_path, trace) && !LoadCsvFile(trace_path, trace)) {
+    std::fprintf(stderr, "%s: unreadable trace\n", trace_path);
+    return 1;
+  }
+  if (trace.empty()) {
+    std::fprintf(stderr, "%s: empty trace\n", trace_path);
+    return 1;
+  }
+  std::stable_sort(trace.begin(), trace.end(),
+                   [](const TraceEntry& a, const TraceEntry& b) { return a.timestamp_us < b.timestamp_us; });
+  const uint64_t t0_us = trace.front().timestamp_us;
+  const double span_ms = static_cast<double>(trace.back().timestamp_us - t0_us) / 1000.0;
+
+  static ReplayCollector collector;
+  for (uint32_t i = 0U; i < kFaults; ++i) {
+    collector.RegisterFault(static_cast<fccu::FaultIndex>(i), 0x10000U + i);
+  }
+  collector.SetDefaultHook(HandledHook);
+
+  std::printf("=== fccu_replay: %zu reports over %.1f ms, %u producer(s), %s ===\n", trace.size(), span_ms,
+              cfg.producers, (cfg.speed == 0.0) ? "max speed" : "paced");
+
+  // Per-producer slices, split by fault index so every fault keeps its order
+  std::vector<std::vector<TraceEntry>> slices(cfg.producers);
+  uint32_t out_of_range = 0U;
+  for (const TraceEntry& e : trace) {
+    if (e.fault_index >= kFaults) {
+      ++out_of_range;
+      continue;
+    }
+    slices[e.fault_index % cfg.producers].push_back(e);
+  }
+
+  std::atomic<uint32_t> ready{0U};
+  std::atomic<bool> go{false};
+  std::atomic<uint32_t> finished{0U};
+  uint64_t start_ns = 0U;
+  std::vector<std::thread> producers;
+  for (uint32_t p = 0U; p < cfg.producers; ++p) {
+    producers.emplace_back([&, p]() {
+      uint8_t lane = 0U;
+      if (collector.RegisterProducer(lane) != fccu::FccuError::kOk) {
+        std::fprintf(stderr, "producer %u: no free lane\n", p);
+        std::exit(1);
+      }
+      ready.fetch_add(1U);
+      while (!go.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+      for (const TraceEntry& e : slices[p]) {
+        if (cfg.speed > 0.0) {
+          const auto due = start_ns + static_cast<uint64_t>(static_cast<double>(e.timestamp_us - t0_us) * 1000.0 /
+                                                            cfg.speed);
+          while (NowNs() < due) {
+            if (due - NowNs() > 200000U) {
+              std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+          }
+        }
+        (void)collector.ReportFaultFrom(lane, e.fault_index, e.detail, e.priority);
+      }
+      finished.fetch_add(1U, std::memory_order_release);
+    });
+  }
+
+  std::array<uint32_t, kLevels> high_water{};
+  while (ready.load() < cfg.producers) {
+    std::this_thread::yield();
+  }
+  start_ns = NowNs();
+  go.store(true, std::memory_order_release);
+  for (;;) {
+    const bool done = finished.load(std::memory_order_acquire) == cfg.producers;
+    for (uint8_t level = 0U; level < kLevels; ++level) {
+      high_water[level] = std::max(high_water[level], collector.GetQueueSize(level));
+    }
+    if (collector.ProcessFaults() == 0U && done) {
+      break;
+    }
+  }
+  const uint64_t wall_ns = NowNs() - start_ns;
+  for (auto& t : producers) {
+    t.join();
+  }
+
+  const fccu::FaultStatistics stats = collector.GetStatistics();
+  static const char* const kLevelNames[kLevels] = {"critical", "high", "medium", "low"};
+  ReplayReport report;
+  report.Add("replay.reports", static_cast<double>(trace.size()), "count");
+  report.Add("replay.wall_time", static_cast<double>(wall_ns) / 1e6, "ms");
+  report.Add("replay.throughput", static_cast<double>(stats.total_processed) * 1e3 / static_cast<double>(wall_ns),
+             "Mops/s");
+  report.Add("replay.out_of_range", out_of_range, "count");
+  report.Add("replay.dropped", static_cast<double>(stats.total_dropped), "count");
+  for (uint32_t level = 0U; level < kLevels; ++level) {
+    const std::string p = std::string("level.") + kLevelNames[level];
+    const auto& h = collector.GetQueueLatency(static_cast<uint8_t>(level));
+    report.Add(p + ".reported", static_cast<double>(stats.priority_reported[level]), "count");
+    report.Add(p + ".dropped", static_cast<double>(stats.priority_dropped[level]), "count");
+    report.Add(p + ".high_water", high_water[level], "entries");
+    report.Add(p + ".latency_p50", static_cast<double>(h.P50()) / 1e3, "us");
+    report.Add(p + ".latency_p99", static_cast<double>(h.P99()) / 1e3, "us");
+    report.Add(p + ".latency_p999", static_cast<double>(h.P999()) / 1e3, "us");
+    report.Add(p + ".latency_max", static_cast<double>(h.Max()) / 1e3, "us");
+  }
+  report.Add("hook.latency_p99", static_cast<double>(collector.GetHookLatency().P99()) / 1e3, "us");
+
+  if (cfg.out_path != nullptr && !report.WriteJson(cfg.out_path)) {
+    std::fprintf(stderr, "failed to write %s\n", cfg.out_path);
+    return 1;
+  }
+  if (cfg.max_drops >= 0 && stats.total_dropped > static_cast<uint64_t>(cfg.max_drops)) {
+    std::fprintf(stderr, "FAIL: %llu dropped > --max-drops %lld\n",
+                 static_cast<unsigned long long>(stats.total_dropped), cfg.max_drops);  // NOLINT(runtime/int)
+    return 3;
+  }
+  return 0;
+}